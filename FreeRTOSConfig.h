@@ -29,20 +29,10 @@
 #define FREERTOS_CONFIG_H
 
 #include <lpc21xx.h>
-#include "GPIO.h"
+#include "edf_trace.h"
 
 
 
-/* Variables for Calculating the times and CPU Load*/
-extern int button1_in_time, button1_out_time,button1_total_time;
-extern int button2_in_time, button2_out_time,button2_total_time;
-extern int periodic_transmitter_in_time, periodic_transmitter_out_time,periodic_transmitter_total_time;
-extern int receiver_in_time, receiver_out_time,receiver_total_time;
-extern int load1_in_time, load1_out_time,load1_total_time;
-extern int load2_in_time, load2_out_time,load2_total_time;
-
-extern int system_time;
-extern int cpu_load;
 /*-----------------------------------------------------------
  * Application specific definitions.
  *
@@ -61,7 +51,11 @@ extern int cpu_load;
 #define configCPU_CLOCK_HZ			( ( unsigned long ) 60000000 )	/* =12.0MHz xtal multiplied by 5 using the PLL. */
 #define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES		( 4 )
-#define configMINIMAL_STACK_SIZE	( ( unsigned short ) 90 )
+#ifdef EDF_POSIX_SIMULATOR
+	#define configMINIMAL_STACK_SIZE	( ( unsigned short ) 4096 )	/* Each task runs on a pthread given its stack, which must hold PTHREAD_STACK_MIN bytes. */
+#else
+	#define configMINIMAL_STACK_SIZE	( ( unsigned short ) 90 )
+#endif
 #define configTOTAL_HEAP_SIZE		( ( size_t ) 13 * 1024 )
 #define configMAX_TASK_NAME_LEN  	( 8 )
 #define configUSE_TRACE_FACILITY	1
@@ -75,89 +69,75 @@ extern int cpu_load;
 /*added by me */
 #define configUSE_EDF_SCHEDULER   1
 
+/* EDF ready queue as a binary min-heap on deadline, sized for all the tasks (idle needs a slot only without configEDF_IDLE_SENTINEL) */
+#define configUSE_EDF_HEAP_READY_QUEUE   1
+#define configEDF_MAX_READY_TASKS        16
+
+/* refuse tasks that would take the total density above 1: the demo tasks declare 0.72, the UART server 0.2 */
+#define configUSE_EDF_ADMISSION_CONTROL   1
+
+/* call vApplicationDeadlineMissHook() in main.c once for every late job */
+#define configUSE_EDF_DEADLINE_MISS_HOOK   1
+
+/* 64 bit time stamps from a 32 bit counter: timer 1 at the 60MHz bus clock (started in prvSetupHardware),
+   or microseconds of CLOCK_MONOTONIC in the Linux simulator (sim/port_timestamp.c) */
+#define configUSE_EDF_HIGH_RES_TIMESTAMP         1
+#ifdef EDF_POSIX_SIMULATOR
+	extern uint32_t ulSimGetHighResTimestamp( void );
+	#define portGET_HIGH_RES_TIMESTAMP()         ulSimGetHighResTimestamp()
+	#define configEDF_HIGH_RES_COUNTS_PER_TICK   1000
+#else
+	#define portGET_HIGH_RES_TIMESTAMP()         ( T1TC )
+	#define configEDF_HIGH_RES_COUNTS_PER_TICK   60000
+#endif
+
+/* run time stats count the time stamps above, used to measure every EDF job and stop it at the WCET its task declared */
+#define configGENERATE_RUN_TIME_STATS            1
+#define configRUN_TIME_COUNTER_TYPE              uint64_t
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()         ullTaskGetHighResTimestamp()
+#define configUSE_EDF_BUDGET_ENFORCEMENT         1
+#define configEDF_RUN_TIME_COUNTS_PER_TICK       configEDF_HIGH_RES_COUNTS_PER_TICK
+
+/* constant bandwidth server for the UART receiver, which waits on the message queue */
+#define configUSE_EDF_CBS            1
+#define configEDF_MAX_CBS_SERVERS    2
+
+/* tasks waiting on the message buffer are woken in deadline order */
+#define configUSE_EDF_DEADLINE_EVENT_LISTS   1
+
+/* jobs with equal deadlines run in the order they became ready, no time slicing between them */
+#define configEDF_TIE_BREAK   taskEDF_TIE_BREAK_FIFO
+
+/* the idle task only runs when no EDF job is ready */
+#define configEDF_IDLE_SENTINEL   1
+
+/* the periodic tasks are all in the EDF band at priority 1, a task made with xTaskCreate above it always preempts them */
+#define configUSE_EDF_PRIORITY_BANDS   1
+#define configEDF_BAND_PRIORITY        1
+
+/* Load_Jobs and the LED on PORT_1 PIN1 are shared under the stack resource policy, load 2 locks both nested */
+#define configUSE_EDF_SRP            1
+#define configEDF_MAX_SRP_RESOURCES  2
+
+/* cpu load over the last second in 8 slots of 125 ticks, and the share of each task, see ulTaskGetSystemLoad() */
+#define configUSE_EDF_LOAD_ACCOUNTING    1
+#define configEDF_LOAD_SLOT_TICKS        125
+#define configEDF_LOAD_WINDOW_SLOTS      8
+
+/* count the jobs of every task by response time and lateness, see vTaskGetHistograms() */
+#define configUSE_EDF_JOB_HISTOGRAMS     1
+
 
 /* trace hooks definitions */
 
-#define traceTASK_SWITCHED_OUT()	if ((int)pxCurrentTCB->pxTaskTag == 2)\
-		{\
-	        GPIO_write (PORT_0, PIN2, PIN_IS_LOW);\
-					button1_out_time = T1TC;\
-					button1_total_time += button1_out_time - button1_in_time;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 3)\
-		{\
-			GPIO_write (PORT_0, PIN3, PIN_IS_LOW);\
-			button2_out_time = T1TC;\
-			button2_total_time += button2_out_time - button2_in_time;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 4)\
-		{\
-			GPIO_write (PORT_0, PIN4, PIN_IS_LOW);\
-			periodic_transmitter_out_time = T1TC;\
-			periodic_transmitter_total_time += periodic_transmitter_out_time - periodic_transmitter_in_time;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 5)\
-		{\
-			GPIO_write (PORT_0, PIN5, PIN_IS_LOW);\
-			receiver_out_time = T1TC;\
-			receiver_total_time += receiver_out_time - receiver_in_time;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 6)\
-		{\
-			GPIO_write (PORT_0, PIN6, PIN_IS_LOW);\
-			load1_out_time = T1TC;\
-			load1_total_time += load1_out_time - load1_in_time;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 7)\
-		{\
-			GPIO_write (PORT_0, PIN7, PIN_IS_LOW);\
-			load2_out_time = T1TC;\
-			load2_total_time += load2_out_time - load2_in_time;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 8)\
-		{\
-			GPIO_write (PORT_1, PIN1, PIN_IS_LOW);\
-		}\
-		\
-		system_time = T1TC;\
-		cpu_load = (button1_total_time + button2_total_time + periodic_transmitter_total_time + receiver_total_time + load1_total_time + load2_total_time ) /(float) system_time * 100 ;\
-
-#define traceTASK_SWITCHED_IN()	  if ((int)pxCurrentTCB->pxTaskTag == 2)\
-		{\
-	        GPIO_write (PORT_0, PIN2, PIN_IS_HIGH);\
-					button1_in_time = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 3)\
-		{\
-			GPIO_write (PORT_0, PIN3, PIN_IS_HIGH);\
-			button2_in_time = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 4)\
-		{\
-			GPIO_write (PORT_0, PIN4, PIN_IS_HIGH);\
-			periodic_transmitter_in_time = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 5)\
-		{\
-			GPIO_write (PORT_0, PIN5, PIN_IS_HIGH);\
-			receiver_in_time = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 6)\
-		{\
-			GPIO_write (PORT_0, PIN6, PIN_IS_HIGH);\
-			load1_in_time = T1TC;\
-		}\
-		else if ((int)pxCurrentTCB->pxTaskTag == 7)\
-		{\
-			GPIO_write (PORT_0, PIN7, PIN_IS_HIGH);\
-			load2_in_time = T1TC;\
-		}\
-		\
-		else if ((int)pxCurrentTCB->pxTaskTag == 8)\
-		{\
-			GPIO_write (PORT_1, PIN1, PIN_IS_HIGH);\
-		}\
+/* every context switch appends a 12 byte record to xEDFTraceRing in edf_trace.c,
+   tools/edf_trace_decode.c turns a memory dump of the ring into per task timelines */
+#define configEDF_TRACE_TIMESTAMP()     ( ( uint32_t ) ullTaskGetHighResTimestamp() )
 
+#define traceTASK_SWITCHED_OUT()        vEDFTraceWrite( edfTRACE_SWITCHED_OUT, configEDF_TRACE_TIMESTAMP(), pxCurrentTCB->uxTCBNumber, pxCurrentTCB->xTaskAbsoluteDeadline )
+#define traceTASK_SWITCHED_IN()         vEDFTraceWrite( edfTRACE_SWITCHED_IN, configEDF_TRACE_TIMESTAMP(), pxCurrentTCB->uxTCBNumber, pxCurrentTCB->xTaskAbsoluteDeadline )
+#define traceTASK_PREEMPTED( pxTCB )    vEDFTraceWrite( edfTRACE_PREEMPTED, configEDF_TRACE_TIMESTAMP(), ( pxTCB )->uxTCBNumber, ( pxTCB )->xTaskAbsoluteDeadline )
 
 
 
@@ -178,6 +158,10 @@ to exclude the API function. */
 #define INCLUDE_vTaskDelayUntil		   	  1
 #define INCLUDE_vTaskDelay				  1
 
+#ifdef EDF_POSIX_SIMULATOR
+	#define INCLUDE_xTaskGetCurrentTaskHandle 1	/* used by the POSIX port */
+#endif
+
 
 
 #endif /* FREERTOS_CONFIG_H */
\ No newline at end of file
@@ -38,6 +38,7 @@
 /* FreeRTOS includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "task_edf.h"
 #include "timers.h"
 #include "stack_macros.h"
 
@@ -115,6 +116,357 @@
     #define configIDLE_TASK_NAME    "IDLE"
 #endif
 
+/* The EDF scheduler is only used if configUSE_EDF_SCHEDULER is set to 1 in
+ * FreeRTOSConfig.h. */
+#ifndef configUSE_EDF_SCHEDULER
+    #define configUSE_EDF_SCHEDULER    0
+#endif
+
+/* By default the EDF ready tasks are held in a list sorted by deadline, which
+ * costs O(n) per insertion.  Setting configUSE_EDF_HEAP_READY_QUEUE to 1 holds
+ * them in an array based binary min-heap instead, which costs O(log n) per
+ * insertion and removal.  configEDF_MAX_READY_TASKS is the capacity of the heap
+ * and must be at least the number of tasks (including the idle task). */
+#ifndef configUSE_EDF_HEAP_READY_QUEUE
+    #define configUSE_EDF_HEAP_READY_QUEUE    0
+#endif
+
+#ifndef configEDF_MAX_READY_TASKS
+    #define configEDF_MAX_READY_TASKS    16
+#endif
+
+/* Set configUSE_EDF_ADMISSION_CONTROL to 1 to have xTaskCreatePeriodicConstrained()
+ * refuse a task whose worst case execution time would take the total density
+ * (the sum of WCET / relative deadline) of the admitted tasks above 1.  Only
+ * tasks that declare a WCET are counted, which xTaskCreatePeriodic() does not. */
+#ifndef configUSE_EDF_ADMISSION_CONTROL
+    #define configUSE_EDF_ADMISSION_CONTROL    0
+#endif
+
+#if ( ( configUSE_EDF_ADMISSION_CONTROL == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+    #error configUSE_EDF_ADMISSION_CONTROL requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+/* Set configUSE_EDF_QPA_ADMISSION to 1 as well to keep a registry of the
+ * admitted tasks, and to run the exact processor demand test of edf_analysis.c
+ * over it whenever the density test alone would refuse a task.  The registry
+ * holds up to configEDF_MAX_ADMITTED_TASKS tasks that declare a WCET. */
+#ifndef configUSE_EDF_QPA_ADMISSION
+    #define configUSE_EDF_QPA_ADMISSION    0
+#endif
+
+#ifndef configEDF_MAX_ADMITTED_TASKS
+    #define configEDF_MAX_ADMITTED_TASKS    configEDF_MAX_READY_TASKS
+#endif
+
+#if ( ( configUSE_EDF_QPA_ADMISSION == 1 ) && ( configUSE_EDF_ADMISSION_CONTROL == 0 ) )
+    #error configUSE_EDF_QPA_ADMISSION requires configUSE_EDF_ADMISSION_CONTROL to be set to 1
+#endif
+
+#if ( configUSE_EDF_QPA_ADMISSION == 1 )
+    #include "edf_analysis.h"
+#endif
+
+/* Set configUSE_EDF_DEADLINE_MISS_HOOK to 1 to have vApplicationDeadlineMissHook()
+ * called the first time each job is found to have missed its deadline. */
+#ifndef configUSE_EDF_DEADLINE_MISS_HOOK
+    #define configUSE_EDF_DEADLINE_MISS_HOOK    0
+#endif
+
+/* Called with the TCB of a task whose current job has just been found late. */
+#ifndef traceTASK_DEADLINE_MISSED
+    #define traceTASK_DEADLINE_MISSED( pxTCB )
+#endif
+
+/* Set configUSE_EDF_BUDGET_ENFORCEMENT to 1 to measure the execution time of
+ * every job with the run time stats counter, and to stop a job from running
+ * past the WCET its task declared.  configEDF_RUN_TIME_COUNTS_PER_TICK converts
+ * the WCET from ticks to run time counter units, and configEDF_DEFAULT_BUDGET_POLICY
+ * is the eTaskBudgetPolicy given to new tasks. */
+#ifndef configUSE_EDF_BUDGET_ENFORCEMENT
+    #define configUSE_EDF_BUDGET_ENFORCEMENT    0
+#endif
+
+#if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        #error configUSE_EDF_BUDGET_ENFORCEMENT requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    #if ( configGENERATE_RUN_TIME_STATS == 0 )
+        #error configUSE_EDF_BUDGET_ENFORCEMENT requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+        #error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the run time counter increments per tick
+    #endif
+
+    #ifndef configEDF_DEFAULT_BUDGET_POLICY
+        #define configEDF_DEFAULT_BUDGET_POLICY    eTaskBudgetDemote
+    #endif
+#endif
+
+/* Called with the TCB of a task whose current job has used up its budget. */
+#ifndef traceTASK_BUDGET_EXHAUSTED
+    #define traceTASK_BUDGET_EXHAUSTED( pxTCB )
+#endif
+
+/* Set configUSE_EDF_CBS to 1 to serve aperiodic work with constant bandwidth
+ * servers.  Each server created with xTaskCreateServer() reserves a budget per
+ * period and schedules the task attached to it on deadlines of its own, so the
+ * task cannot take more than that share from the periodic tasks.  The servers
+ * come from a static pool of configEDF_MAX_CBS_SERVERS.  The budget is charged
+ * with the run time stats counter, as for configUSE_EDF_BUDGET_ENFORCEMENT. */
+#ifndef configUSE_EDF_CBS
+    #define configUSE_EDF_CBS    0
+#endif
+
+#ifndef configEDF_MAX_CBS_SERVERS
+    #define configEDF_MAX_CBS_SERVERS    4
+#endif
+
+#if ( configUSE_EDF_CBS == 1 )
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        #error configUSE_EDF_CBS requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    #if ( configGENERATE_RUN_TIME_STATS == 0 )
+        #error configUSE_EDF_CBS requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+        #error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the run time counter increments per tick
+    #endif
+#endif
+
+/* Called with the TCB of a served task whose server deadline has just been
+ * postponed because the budget ran out. */
+#ifndef traceTASK_SERVER_POSTPONED
+    #define traceTASK_SERVER_POSTPONED( pxTCB )
+#endif
+
+/* Set configUSE_EDF_SRP to 1 to share resources between EDF tasks with the
+ * Stack Resource Policy.  Up to configEDF_MAX_SRP_RESOURCES resources can be
+ * created with xTaskCreateResource(). */
+#ifndef configUSE_EDF_SRP
+    #define configUSE_EDF_SRP    0
+#endif
+
+#ifndef configEDF_MAX_SRP_RESOURCES
+    #define configEDF_MAX_SRP_RESOURCES    4
+#endif
+
+#if ( ( configUSE_EDF_SRP == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+    #error configUSE_EDF_SRP requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+/* The order in which ready jobs with equal absolute deadlines run, one of the
+ * taskEDF_TIE_BREAK_ values in task_edf.h.  Under EDF this takes the place of
+ * configUSE_TIME_SLICING: a context switch only happens when the earliest
+ * deadline changes, except that with taskEDF_TIE_BREAK_ROUND_ROBIN the tick also
+ * shares the processor between the jobs that tie for it. */
+#ifndef configEDF_TIE_BREAK
+    #define configEDF_TIE_BREAK    taskEDF_TIE_BREAK_FIFO
+#endif
+
+/* Set configEDF_IDLE_SENTINEL to 1 to keep the idle task out of the EDF ready
+ * queue.  It is then picked only when no job is ready, never competes with a
+ * job on deadline, and no longer moves its own deadline on every pass. */
+#ifndef configEDF_IDLE_SENTINEL
+    #define configEDF_IDLE_SENTINEL    0
+#endif
+
+#if ( ( configEDF_IDLE_SENTINEL == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+    #error configEDF_IDLE_SENTINEL requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+/* Set configUSE_EDF_PRIORITY_BANDS to 1 to schedule only the tasks of priority
+ * configEDF_BAND_PRIORITY by deadline.  Tasks of a higher priority preempt the
+ * whole band and tasks of a lower one only run when it is empty, both by fixed
+ * priority as without EDF.  xTaskCreate() is then available for them. */
+#ifndef configUSE_EDF_PRIORITY_BANDS
+    #define configUSE_EDF_PRIORITY_BANDS    0
+#endif
+
+#ifndef configEDF_BAND_PRIORITY
+    #define configEDF_BAND_PRIORITY    1
+#endif
+
+#if ( ( configUSE_EDF_PRIORITY_BANDS == 1 ) && ( configEDF_IDLE_SENTINEL == 0 ) )
+    #error configUSE_EDF_PRIORITY_BANDS requires configEDF_IDLE_SENTINEL to be set to 1
+#endif
+
+#if ( ( configUSE_EDF_PRIORITY_BANDS == 1 ) && ( ( configEDF_BAND_PRIORITY < 1 ) || ( configEDF_BAND_PRIORITY >= configMAX_PRIORITIES ) ) )
+    #error configEDF_BAND_PRIORITY must be above the idle priority and below configMAX_PRIORITIES
+#endif
+
+/* Set configUSE_EDF_DEADLINE_EVENT_LISTS to 1 to order the tasks waiting on a
+ * queue, semaphore or other event list by absolute deadline instead of by
+ * priority, so the event always wakes the most urgent waiter. */
+#ifndef configUSE_EDF_DEADLINE_EVENT_LISTS
+    #define configUSE_EDF_DEADLINE_EVENT_LISTS    0
+#endif
+
+#if ( ( configUSE_EDF_DEADLINE_EVENT_LISTS == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+    #error configUSE_EDF_DEADLINE_EVENT_LISTS requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+/* Called with the TCB of a mutex holder and the earlier deadline it inherits,
+ * and again with its own deadline when the inheritance ends. */
+#ifndef traceTASK_DEADLINE_INHERIT
+    #define traceTASK_DEADLINE_INHERIT( pxTCB, xDeadline )
+#endif
+
+#ifndef traceTASK_DEADLINE_DISINHERIT
+    #define traceTASK_DEADLINE_DISINHERIT( pxTCB, xDeadline )
+#endif
+
+/* Called from the context switch with the TCB of a task switched out while
+ * still ready. */
+#ifndef traceTASK_PREEMPTED
+    #define traceTASK_PREEMPTED( pxTCB )
+#endif
+
+/* Called from the context switch with the TCB of a task switched in on another
+ * core than the one it last ran on, see configUSE_EDF_GLOBAL_SCHEDULING. */
+#ifndef traceTASK_MIGRATED
+    #define traceTASK_MIGRATED( pxTCB )
+#endif
+
+/* Set configUSE_EDF_HIGH_RES_TIMESTAMP to 1 to extend portGET_HIGH_RES_TIMESTAMP(),
+ * a 32 bit free running up counter provided by the port, to the 64 bit time
+ * stamps of ullTaskGetHighResTimestamp().  The wraps of the counter are counted
+ * from the tick interrupt, so it must not wrap more than once between two
+ * ticks, tickless sleeps included.  configEDF_HIGH_RES_COUNTS_PER_TICK is the
+ * number of counts in one tick, used to measure deadline misses in counts. */
+#ifndef configUSE_EDF_HIGH_RES_TIMESTAMP
+    #define configUSE_EDF_HIGH_RES_TIMESTAMP    0
+#endif
+
+#if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        #error configUSE_EDF_HIGH_RES_TIMESTAMP requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    #ifndef portGET_HIGH_RES_TIMESTAMP
+        #error portGET_HIGH_RES_TIMESTAMP() must be defined to read a 32 bit free running up counter
+    #endif
+
+    #ifndef configEDF_HIGH_RES_COUNTS_PER_TICK
+        #error configEDF_HIGH_RES_COUNTS_PER_TICK must be defined to the portGET_HIGH_RES_TIMESTAMP() increments per tick
+    #endif
+#endif
+
+/* Set configUSE_EDF_JOB_HISTOGRAMS to 1 to count the jobs of every periodic
+ * task by response time and by lateness, in configEDF_HISTOGRAM_BUCKETS log2
+ * buckets, see vTaskGetHistograms(). */
+#ifndef configUSE_EDF_JOB_HISTOGRAMS
+    #define configUSE_EDF_JOB_HISTOGRAMS    0
+#endif
+
+#if ( ( configUSE_EDF_JOB_HISTOGRAMS == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
+    #error configUSE_EDF_JOB_HISTOGRAMS requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+#if ( ( configUSE_EDF_JOB_HISTOGRAMS == 1 ) && ( configEDF_HISTOGRAM_BUCKETS < 2 ) )
+    #error configEDF_HISTOGRAM_BUCKETS must be at least 2
+#endif
+
+/* Set configUSE_EDF_LOAD_ACCOUNTING to 1 to charge the run time of every task,
+ * and of the system as a whole, to windows of configEDF_LOAD_SLOT_TICKS ticks.
+ * The system load is then known over the last configEDF_LOAD_WINDOW_SLOTS slots,
+ * and the run time of each task over the last whole window of that length, see
+ * ulTaskGetSystemLoad() and vTaskGetLoadStats(). */
+#ifndef configUSE_EDF_LOAD_ACCOUNTING
+    #define configUSE_EDF_LOAD_ACCOUNTING    0
+#endif
+
+#if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        #error configUSE_EDF_LOAD_ACCOUNTING requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    #if ( configGENERATE_RUN_TIME_STATS == 0 )
+        #error configUSE_EDF_LOAD_ACCOUNTING requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_LOAD_SLOT_TICKS
+        #define configEDF_LOAD_SLOT_TICKS    100
+    #endif
+
+    #ifndef configEDF_LOAD_WINDOW_SLOTS
+        #define configEDF_LOAD_WINDOW_SLOTS    8
+    #endif
+
+    #if ( ( configEDF_LOAD_SLOT_TICKS < 1 ) || ( configEDF_LOAD_WINDOW_SLOTS < 1 ) )
+        #error configEDF_LOAD_SLOT_TICKS and configEDF_LOAD_WINDOW_SLOTS must be at least 1
+    #endif
+#endif
+
+/* Set configEDF_NUMBER_OF_CORES above 1 to run the EDF tasks on that many cores
+ * sharing this kernel, under partitioned EDF: each task is pinned to the core
+ * given to xTaskCreatePeriodicOnCore(), and each core runs the earliest
+ * deadline job of a ready list of its own, or an idle task of its own when the
+ * list is empty.  The tasks are assigned to the cores offline or at boot, for
+ * example with eEDFAnalysisPartition() of edf_analysis.h.
+ *
+ * The port provides portGET_CORE_ID(), the number of the calling core counted
+ * from 0, and portYIELD_CORE( xCoreID ), which interrupts another core to have
+ * it call vTaskSwitchContext().  Its critical sections must exclude the other
+ * cores as well, and the tick interrupt must only run on one core.  The options
+ * that keep state for a single processor cannot be used with several cores. */
+#ifndef configEDF_NUMBER_OF_CORES
+    #define configEDF_NUMBER_OF_CORES    1
+#endif
+
+/* Set configUSE_EDF_GLOBAL_SCHEDULING to 1 to run global EDF on the cores
+ * instead: the tasks are not pinned and share one deadline ordered ready list,
+ * each core runs the earliest deadline ready job no other core is running, so
+ * the configEDF_NUMBER_OF_CORES earliest jobs run, and a job that becomes ready
+ * interrupts the core running the latest deadline if it is earlier.  A job that
+ * resumes on another core than it last ran on counts as a migration, see
+ * vTaskGetDeadlineStats(). */
+#ifndef configUSE_EDF_GLOBAL_SCHEDULING
+    #define configUSE_EDF_GLOBAL_SCHEDULING    0
+#endif
+
+#if ( ( configUSE_EDF_GLOBAL_SCHEDULING == 1 ) && ( configEDF_NUMBER_OF_CORES < 2 ) )
+    #error configUSE_EDF_GLOBAL_SCHEDULING requires configEDF_NUMBER_OF_CORES to be at least 2
+#endif
+
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        #error configEDF_NUMBER_OF_CORES above 1 requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    #ifndef portGET_CORE_ID
+        #error portGET_CORE_ID() must be defined to the number of the calling core
+    #endif
+
+    #ifndef portYIELD_CORE
+        #error portYIELD_CORE( xCoreID ) must be defined to request a context switch on another core
+    #endif
+
+    #if ( configEDF_IDLE_SENTINEL == 0 )
+        #error configEDF_NUMBER_OF_CORES above 1 requires configEDF_IDLE_SENTINEL to be set to 1
+    #endif
+
+    #if ( ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) || ( configUSE_EDF_PRIORITY_BANDS == 1 ) || ( configUSE_EDF_SRP == 1 ) || ( configUSE_EDF_CBS == 1 ) )
+        #error configEDF_NUMBER_OF_CORES above 1 cannot be used with the EDF ready heap, priority bands, SRP or CBS
+    #endif
+
+    #if ( ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 ) || ( configUSE_EDF_ADMISSION_CONTROL == 1 ) || ( configUSE_EDF_LOAD_ACCOUNTING == 1 ) )
+        #error configEDF_NUMBER_OF_CORES above 1 cannot be used with budget enforcement, admission control or load accounting
+    #endif
+
+    #if ( ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_ROUND_ROBIN ) || ( configUSE_TICKLESS_IDLE != 0 ) || ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        #error configEDF_NUMBER_OF_CORES above 1 cannot be used with round robin ties, tickless idle or a statically allocated idle task
+    #endif
+#else
+    #ifndef portGET_CORE_ID
+        #define portGET_CORE_ID()    0
+    #endif
+#endif
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -224,22 +576,358 @@
     taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
     listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
     tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+/* The ready lists need nothing more than uxListRemove(). */
+#define prvRemoveTaskFromReadyHeap( pxTCB )
 /*-----------------------------------------------------------*/
 
 		
-#else 
+#elif ( configUSE_EDF_HEAP_READY_QUEUE == 0 )
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
-#define prvAddTaskToReadyList( pxTCB )                                                                 \
-    traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
-    taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
-    vListInsert( &(xReadyTasksListEDF), &( ( pxTCB )->xStateListItem ) ) \
+#define prvAddTaskToReadyList( pxTCB )                                                                     \
+    traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                               \
+    if( taskEDF_IN_EDF_BAND( pxTCB ) == pdFALSE )                                                          \
+    {                                                                                                      \
+        taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
+        listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+    }                                                                                                      \
+    else                                                                                                   \
+    {                                                                                                      \
+        taskEDF_SERVER_ACTIVATE( pxTCB );                                                                  \
+        prvEDFReadyListInsert( pxTCB );                                                                    \
+    }                                                                                                      \
     tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+/* The sorted ready list needs nothing more than uxListRemove(). */
+#define prvRemoveTaskFromReadyHeap( pxTCB )
 /*-----------------------------------------------------------*/
-		
+
+#else
+
+/*
+ * Place the task represented by pxTCB into the EDF ready heap.  The state list
+ * item is still appended to xReadyTasksListEDF, in O(1), so the container of
+ * the item keeps identifying the task as Ready, but only the heap is ordered.
+ */
+#define prvAddTaskToReadyList( pxTCB )                                                                     \
+    traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                               \
+    if( taskEDF_IN_EDF_BAND( pxTCB ) == pdFALSE )                                                          \
+    {                                                                                                      \
+        taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
+        listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+    }                                                                                                      \
+    else                                                                                                   \
+    {                                                                                                      \
+        taskEDF_SERVER_ACTIVATE( pxTCB );                                                                  \
+        listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( pxTCB )->xTaskAbsoluteDeadline );       \
+        listINSERT_END( &( xReadyTasksListEDF ), &( ( pxTCB )->xStateListItem ) );                         \
+        taskEDF_STAMP_TIE_KEY( pxTCB );                                                                    \
+        prvEDFReadyHeapInsert( pxTCB );                                                                    \
+    }                                                                                                      \
+    tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+/*
+ * Must accompany every uxListRemove() of a state list item that may be
+ * referenced from the ready list.  Does nothing if the task is not in the heap.
+ */
+#define prvRemoveTaskFromReadyHeap( pxTCB )    prvEDFReadyHeapRemove( pxTCB )
+/*-----------------------------------------------------------*/
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+/* The absolute deadline of the current job of a task.  It is kept in the TCB
+ * rather than only in the state list item, as the item value is overwritten
+ * with the wake time while the task is in a delayed list. */
+    #define taskEDF_GET_DEADLINE( pxTCB )    ( ( pxTCB )->xTaskAbsoluteDeadline )
+
+/* The deadline of the current job of the task itself.  While a mutex holder
+ * runs on the earlier deadline of a task waiting for the mutex, its own
+ * deadline is kept in xTaskBaseDeadline, and every change made to it there
+ * takes effect when the inheritance ends. */
+    #if ( configUSE_MUTEXES == 1 )
+        #define taskEDF_GET_OWN_DEADLINE( pxTCB )    ( ( ( pxTCB )->ucEDFDeadlineInherited != pdFALSE ) ? ( pxTCB )->xTaskBaseDeadline : ( pxTCB )->xTaskAbsoluteDeadline )
+        #define taskEDF_SET_OWN_DEADLINE( pxTCB, xDeadline )                                                         \
+    {                                                                                                                \
+        if( ( pxTCB )->ucEDFDeadlineInherited != pdFALSE )                                                           \
+        {                                                                                                            \
+            ( pxTCB )->xTaskBaseDeadline = ( xDeadline );                                                            \
+                                                                                                                     \
+            if( taskEDF_DEADLINE_IS_BEFORE( ( pxTCB )->xTaskBaseDeadline, ( pxTCB )->xTaskAbsoluteDeadline ) )        \
+            {                                                                                                        \
+                ( pxTCB )->xTaskAbsoluteDeadline = ( pxTCB )->xTaskBaseDeadline;                                     \
+            }                                                                                                        \
+        }                                                                                                            \
+        else                                                                                                         \
+        {                                                                                                            \
+            ( pxTCB )->xTaskAbsoluteDeadline = ( xDeadline );                                                        \
+        }                                                                                                            \
+    }
+    #else
+        #define taskEDF_GET_OWN_DEADLINE( pxTCB )               ( ( pxTCB )->xTaskAbsoluteDeadline )
+        #define taskEDF_SET_OWN_DEADLINE( pxTCB, xDeadline )    ( ( pxTCB )->xTaskAbsoluteDeadline = ( xDeadline ) )
+    #endif
+
+/* Absolute deadlines are compared on the modular difference of their tick
+ * values, so the order stays correct when the tick count wraps and the delayed
+ * lists are switched.  This holds as long as no two deadlines being compared
+ * are more than taskEDF_DEADLINE_HORIZON ticks apart, which is why periods are
+ * limited to that value too. */
+    #define taskEDF_DEADLINE_HORIZON    ( portMAX_DELAY >> 1 )
+
+/* pdTRUE if deadline xA is strictly earlier than deadline xB. */
+    #define taskEDF_DEADLINE_IS_BEFORE( xA, xB )    ( ( ( TickType_t ) ( ( TickType_t ) ( xB ) - ( TickType_t ) ( xA ) ) - ( TickType_t ) 1U ) < taskEDF_DEADLINE_HORIZON )
+
+/* pdTRUE if deadline xA is earlier than or equal to deadline xB. */
+    #define taskEDF_DEADLINE_IS_BEFORE_OR_AT( xA, xB )    ( ( TickType_t ) ( ( TickType_t ) ( xB ) - ( TickType_t ) ( xA ) ) <= taskEDF_DEADLINE_HORIZON )
+
+/* Start a new job of pxTCB released at tick xRelease.  The deadline is taken
+ * from the release instant, not from the tick at which the task actually gets
+ * unblocked, so release jitter does not push the deadlines of later jobs. */
+    #define taskEDF_RELEASE_JOB( pxTCB, xRelease )                                                            \
+    {                                                                                                         \
+        ( pxTCB )->xTaskReleaseTime = ( xRelease );                                                           \
+        taskEDF_SET_OWN_DEADLINE( pxTCB, ( pxTCB )->xTaskReleaseTime + ( pxTCB )->xTaskRelativeDeadline );    \
+        ( pxTCB )->ucEDFMissRecorded = pdFALSE;                                                               \
+        taskEDF_SRP_NEW_JOB( pxTCB );                                                                         \
+        taskEDF_START_JOB_ACCOUNTING( pxTCB );                                                                \
+    }
+
+/* Give a new job the full budget of its task. */
+    #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+        #define taskEDF_START_JOB_ACCOUNTING( pxTCB )                 \
+    {                                                                 \
+        ( pxTCB )->ulEDFJobRunTime = 0U;                              \
+        ( pxTCB )->ulEDFBudgetLimit = ( pxTCB )->ulEDFBudget;         \
+        ( pxTCB )->ucEDFBudgetExhausted = pdFALSE;                    \
+    }
+    #else
+        #define taskEDF_START_JOB_ACCOUNTING( pxTCB )
+    #endif
+
+/* pdTRUE once the current job of pxTCB has been released.  Only a task created
+ * with a phase has a release time still in the future. */
+    #define taskEDF_IS_RELEASED( pxTCB )    ( ( taskEDF_DEADLINE_IS_BEFORE( xTickCount, ( pxTCB )->xTaskReleaseTime ) != pdFALSE ) ? pdFALSE : pdTRUE )
+
+/* Equal deadlines are ordered by uxEDFTieKey, the lower key first.  The task
+ * number is set once at creation.  Otherwise the key is a sequence number taken
+ * when the task enters the heap - the sorted list keeps equal deadlines in the
+ * order they were inserted without one. */
+    #if ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_TASK_NUMBER )
+        #define taskEDF_TIE_IS_BEFORE( pxA, pxB )    ( ( pxA )->uxEDFTieKey < ( pxB )->uxEDFTieKey )
+        #define taskEDF_STAMP_TIE_KEY( pxTCB )
+    #else
+        #define taskEDF_TIE_IS_BEFORE( pxA, pxB )    ( ( BaseType_t ) ( ( pxA )->uxEDFTieKey - ( pxB )->uxEDFTieKey ) < ( BaseType_t ) 0 )
+        #if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+            #define taskEDF_STAMP_TIE_KEY( pxTCB )    ( ( pxTCB )->uxEDFTieKey = uxEDFReadySequence++ )
+        #else
+            #define taskEDF_STAMP_TIE_KEY( pxTCB )
+        #endif
+    #endif
+
+/* pdTRUE if pxA is to run before pxB: an earlier deadline, or the same deadline
+ * and the tie broken in favour of pxA. */
+    #define taskEDF_RUNS_BEFORE( pxA, pxB )                                                                                      \
+    ( ( taskEDF_DEADLINE_IS_BEFORE( taskEDF_GET_DEADLINE( pxA ), taskEDF_GET_DEADLINE( pxB ) ) != pdFALSE ) ||                 \
+      ( ( taskEDF_GET_DEADLINE( pxA ) == taskEDF_GET_DEADLINE( pxB ) ) && ( taskEDF_TIE_IS_BEFORE( ( pxA ), ( pxB ) ) ) ) )
+
+/* The deadline given to the idle task.  A released job has its deadline at
+ * most one period ahead, or two once postponed by its budget policy, so the
+ * idle task is behind every ready job.  Server deadlines can be postponed
+ * further and are checked by prvEDFRefreshIdleDeadline(). */
+    #define taskEDF_IDLE_DEADLINE()                                                  \
+    ( xTickCount + ( ( xEDFLongestPeriod < ( taskEDF_DEADLINE_HORIZON >> 1 ) ) ?      \
+                     ( ( TickType_t ) ( xEDFLongestPeriod << 1 ) + ( TickType_t ) 1U ) : \
+                     taskEDF_DEADLINE_HORIZON ) )
+
+/* The EDF ready list pxTCB is queued in, and the one core xCoreID takes its
+ * jobs from.  With several cores each core has a list of its own, and a task
+ * is queued in the list of the core it is pinned to, unless the scheduling is
+ * global and all the cores share the one list. */
+    #if ( ( configEDF_NUMBER_OF_CORES > 1 ) && ( configUSE_EDF_GLOBAL_SCHEDULING == 0 ) )
+        #define taskEDF_READY_LIST( pxTCB )           ( &( xReadyTasksListsEDF[ ( pxTCB )->xEDFCore ] ) )
+        #define taskEDF_CORE_READY_LIST( xCoreID )    ( &( xReadyTasksListsEDF[ ( xCoreID ) ] ) )
+        #define taskEDF_READY_LIST_COUNT              configEDF_NUMBER_OF_CORES
+    #else
+        #define taskEDF_READY_LIST( pxTCB )           ( &( xReadyTasksListEDF ) )
+        #define taskEDF_CORE_READY_LIST( xCoreID )    ( &( xReadyTasksListEDF ) )
+        #define taskEDF_READY_LIST_COUNT              1
+    #endif
+
+/* pdTRUE if pxTCB is an idle task - with several cores the idle task of the
+ * core it is pinned to, which the idle tasks stay on even with global
+ * scheduling. */
+    #if ( configEDF_NUMBER_OF_CORES > 1 )
+        #define taskEDF_IS_IDLE_TASK( pxTCB )    ( ( ( pxTCB ) == xIdleTaskHandles[ ( pxTCB )->xEDFCore ] ) ? pdTRUE : pdFALSE )
+    #else
+        #define taskEDF_IS_IDLE_TASK( pxTCB )    ( ( ( pxTCB ) == xIdleTaskHandle ) ? pdTRUE : pdFALSE )
+    #endif
+
+/* pdTRUE if pxTCB is scheduled by deadline from the EDF ready queue.  The
+ * others wait in pxReadyTasksLists[ uxPriority ]: with configEDF_IDLE_SENTINEL
+ * the idle task, picked when the queue is empty, and with
+ * configUSE_EDF_PRIORITY_BANDS every task outside configEDF_BAND_PRIORITY.
+ * With several cores that is the idle task of every core.
+ * taskEDF_OUTRANKS_CURRENT() is pdTRUE if pxTCB, just made ready, preempts the
+ * running task whatever their deadlines - because it is in a higher band, or
+ * because the running task is the idle sentinel. */
+    #if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+        #define taskEDF_IN_EDF_BAND( pxTCB )         ( ( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_BAND_PRIORITY ) ? pdTRUE : pdFALSE )
+        #define taskEDF_OUTRANKS_CURRENT( pxTCB )    ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority )
+    #elif ( configEDF_NUMBER_OF_CORES > 1 )
+        #define taskEDF_IN_EDF_BAND( pxTCB )         ( ( taskEDF_IS_IDLE_TASK( pxTCB ) == pdFALSE ) ? pdTRUE : pdFALSE )
+        #define taskEDF_OUTRANKS_CURRENT( pxTCB )    ( pxCurrentTCB == xIdleTaskHandle )
+    #elif ( configEDF_IDLE_SENTINEL == 1 )
+        #define taskEDF_IN_EDF_BAND( pxTCB )         ( ( ( pxTCB ) != xIdleTaskHandle ) ? pdTRUE : pdFALSE )
+        #define taskEDF_OUTRANKS_CURRENT( pxTCB )    ( pxCurrentTCB == xIdleTaskHandle )
+    #else
+        #define taskEDF_IN_EDF_BAND( pxTCB )         pdTRUE
+        #define taskEDF_OUTRANKS_CURRENT( pxTCB )    pdFALSE
+    #endif
+
+    #if ( configEDF_IDLE_SENTINEL == 1 )
+        #define taskEDF_OR_IDLE_SENTINEL( pxTCB )    ( ( ( pxTCB ) != NULL ) ? ( pxTCB ) : xIdleTaskHandle )
+    #else
+        #define taskEDF_OR_IDLE_SENTINEL( pxTCB )    ( pxTCB )
+    #endif
+
+/* The value a waiter is ordered by in a deadline ordered event list.  A task
+ * outside the band has no deadline of its own, so it is keyed at the tick count
+ * when above the band and at the horizon when below it, less its priority, to
+ * sort it against the jobs of the band the way the scheduler would. */
+    #if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+        #define taskEDF_EVENT_LIST_KEY( pxTCB )                                                   \
+    ( ( taskEDF_IN_EDF_BAND( pxTCB ) != pdFALSE ) ? taskEDF_GET_DEADLINE( pxTCB ) :               \
+      ( ( ( ( pxTCB )->uxPriority > ( UBaseType_t ) configEDF_BAND_PRIORITY ) ? xTickCount :    \
+          ( TickType_t ) ( xTickCount + taskEDF_DEADLINE_HORIZON ) ) - ( TickType_t ) ( pxTCB )->uxPriority ) )
+    #else
+        #define taskEDF_EVENT_LIST_KEY( pxTCB )    taskEDF_GET_DEADLINE( pxTCB )
+    #endif
+
+/* pdTRUE if pxTCB, just made ready, outranks the running task or has an
+ * earlier deadline in the same band.  Every path that wakes a task decides on a
+ * context switch with this in place of the priority comparison, so the woken
+ * task runs at once instead of at the next tick.  Equal deadlines do not
+ * preempt, as the woken task is queued behind the running one.  With several
+ * cores the task is compared with the job running on its own core, or with
+ * global scheduling on the core running the latest deadline, instead, see
+ * prvEDFPreemptCore(), which interrupts that core itself if it is another one. */
+    #if ( configEDF_NUMBER_OF_CORES > 1 )
+        #define taskEDF_PREEMPTS_CURRENT( pxTCB )    prvEDFPreemptCore( ( pxTCB ), pdFALSE )
+    #else
+        #define taskEDF_PREEMPTS_CURRENT( pxTCB )                                           \
+    ( ( taskEDF_OUTRANKS_CURRENT( pxTCB ) ) ||                                              \
+      ( ( taskEDF_IN_EDF_BAND( pxTCB ) != pdFALSE ) &&                                      \
+        ( taskEDF_IN_EDF_BAND( pxCurrentTCB ) != pdFALSE ) &&                               \
+        ( taskEDF_DEADLINE_IS_BEFORE( taskEDF_GET_DEADLINE( pxTCB ), taskEDF_GET_DEADLINE( pxCurrentTCB ) ) ) ) )
+    #endif
+
+/* As taskEDF_PREEMPTS_CURRENT(), but an equal deadline also preempts.  Used for
+ * a task released by the tick or created, as a running job that has reached its
+ * deadline has overrun it. */
+    #if ( configEDF_NUMBER_OF_CORES > 1 )
+        #define taskEDF_PREEMPTS_CURRENT_OR_TIES( pxTCB )    prvEDFPreemptCore( ( pxTCB ), pdTRUE )
+    #else
+        #define taskEDF_PREEMPTS_CURRENT_OR_TIES( pxTCB )                                   \
+    ( ( taskEDF_OUTRANKS_CURRENT( pxTCB ) ) ||                                              \
+      ( ( taskEDF_IN_EDF_BAND( pxTCB ) != pdFALSE ) &&                                      \
+        ( taskEDF_IN_EDF_BAND( pxCurrentTCB ) != pdFALSE ) &&                               \
+        ( taskEDF_DEADLINE_IS_BEFORE_OR_AT( taskEDF_GET_DEADLINE( pxTCB ), taskEDF_GET_DEADLINE( pxCurrentTCB ) ) ) ) )
+    #endif
+
+/* The ready task with the earliest deadline in the ready queue core xCoreID
+ * takes its jobs from, or NULL if no task is ready there.  The root of the
+ * heap, or the head of the sorted list, so no search is needed.
+ * taskEDF_GET_EARLIEST_READY_TASK() is the one of the calling core. */
+    #if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+        #define taskEDF_GET_EARLIEST_READY_TASK_ON( xCoreID )    ( ( uxEDFReadyHeapSize > ( UBaseType_t ) 0U ) ? pxEDFReadyHeap[ 0 ] : NULL )
+    #else
+        #define taskEDF_GET_EARLIEST_READY_TASK_ON( xCoreID )                       \
+    ( ( listLIST_IS_EMPTY( taskEDF_CORE_READY_LIST( xCoreID ) ) != pdFALSE ) ? NULL : \
+      ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( taskEDF_CORE_READY_LIST( xCoreID ) ) )
+    #endif
+
+    #define taskEDF_GET_EARLIEST_READY_TASK()    taskEDF_GET_EARLIEST_READY_TASK_ON( portGET_CORE_ID() )
+
+/* Make the ready task with the earliest deadline the current task.  Under SRP
+ * only a task allowed past the system ceiling can be picked, and its job is
+ * marked as started.  With priority bands the fixed priority lists above and
+ * below the band are checked around it. */
+    #if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+        #define taskSELECT_EARLIEST_DEADLINE_TASK()    prvEDFSelectBandedTask()
+    #elif ( configUSE_EDF_SRP == 1 )
+        #define taskSELECT_EARLIEST_DEADLINE_TASK()                        \
+    {                                                                      \
+        TCB_t * const pxEDFSelectedTCB = prvEDFSRPSelectTask();            \
+        pxCurrentTCB = taskEDF_OR_IDLE_SENTINEL( pxEDFSelectedTCB );       \
+        configASSERT( pxCurrentTCB != NULL );                              \
+        pxCurrentTCB->ucEDFJobStarted = pdTRUE;                            \
+    }
+    #elif ( configEDF_NUMBER_OF_CORES > 1 )
+        #define taskSELECT_EARLIEST_DEADLINE_TASK()    ( pxCurrentTCB = prvEDFSelectTaskForCore( portGET_CORE_ID() ) )
+    #else
+        #define taskSELECT_EARLIEST_DEADLINE_TASK()                        \
+    {                                                                      \
+        TCB_t * const pxEDFSelectedTCB = taskEDF_GET_EARLIEST_READY_TASK(); \
+        pxCurrentTCB = taskEDF_OR_IDLE_SENTINEL( pxEDFSelectedTCB );       \
+        configASSERT( pxCurrentTCB != NULL );                              \
+    }
+    #endif
+
+/* The preemption level of a task is given by its relative deadline - the
+ * shorter the deadline, the higher the level.  A job that has not started yet
+ * may only start while no resource is locked, or if its level is above the
+ * system ceiling.  A job that has started was already checked. */
+    #if ( configUSE_EDF_SRP == 1 )
+        #define taskEDF_SRP_MAY_RUN( pxTCB )                                    \
+    ( ( uxEDFCeilingStackDepth == ( UBaseType_t ) 0U ) ||                       \
+      ( ( pxTCB )->ucEDFJobStarted != pdFALSE ) ||                              \
+      ( ( pxTCB )->xTaskRelativeDeadline < xEDFCeilingStack[ uxEDFCeilingStackDepth - ( UBaseType_t ) 1U ] ) )
+        #define taskEDF_SRP_NEW_JOB( pxTCB )    ( ( pxTCB )->ucEDFJobStarted = pdFALSE )
+    #else
+        #define taskEDF_SRP_NEW_JOB( pxTCB )
+    #endif
+
+/* Densities are held as fixed point fractions of taskEDF_DENSITY_ONE, which
+ * stands for a fully loaded processor. */
+    #define taskEDF_DENSITY_ONE    ( ( uint32_t ) 1UL << 16 )
+
+/* Value of uxEDFAdmittedIndex while a task is not in the admission registry. */
+    #define taskEDF_NOT_ADMITTED    ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) )
+
+/* Value of uxEDFHeapIndex while a task is not referenced from the ready heap. */
+    #define taskEDF_NOT_IN_READY_HEAP    ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) )
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+/* A served task becomes ready with the deadline of its server, and its server
+ * goes idle again when the task leaves the Ready state.  The budget of a server
+ * is charged in run time counter units. */
+#if ( configUSE_EDF_CBS == 1 )
+    #define taskEDF_SERVER_BUDGET( pxServer )    ( ( configRUN_TIME_COUNTER_TYPE ) ( pxServer )->xBudget * ( configRUN_TIME_COUNTER_TYPE ) configEDF_RUN_TIME_COUNTS_PER_TICK )
+    #define taskEDF_SERVER_ACTIVATE( pxTCB )           \
+    {                                                  \
+        if( ( pxTCB )->pxEDFServer != NULL )           \
+        {                                              \
+            prvEDFServerActivate( pxTCB );             \
+        }                                              \
+    }
+    #define taskEDF_SERVER_DEACTIVATE( pxTCB )         \
+    {                                                  \
+        if( ( pxTCB )->pxEDFServer != NULL )           \
+        {                                              \
+            ( pxTCB )->pxEDFServer->xActive = pdFALSE; \
+        }                                              \
+    }
+#else
+    #define taskEDF_SERVER_ACTIVATE( pxTCB )
+    #define taskEDF_SERVER_DEACTIVATE( pxTCB )
 #endif
+
 /*
  * Several functions take a TaskHandle_t parameter that can optionally be NULL,
  * where NULL is used to indicate that the handle of the currently executing
@@ -248,6 +936,14 @@
  */
 #define prvGetTCBFromHandle( pxHandle )    ( ( ( pxHandle ) == NULL ) ? pxCurrentTCB : ( pxHandle ) )
 
+/* pdTRUE if pxTCB is running, on this core or, with several cores, on any. */
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+    #define taskEDF_NOT_RUNNING              ( ( BaseType_t ) -1 )
+    #define taskTASK_IS_RUNNING( pxTCB )     ( ( prvEDFRunningCore( pxTCB ) != taskEDF_NOT_RUNNING ) ? pdTRUE : pdFALSE )
+#else
+    #define taskTASK_IS_RUNNING( pxTCB )     ( ( ( pxTCB ) == pxCurrentTCB ) ? pdTRUE : pdFALSE )
+#endif
+
 /* The item value of the event list item is normally used to hold the priority
  * of the task to which it belongs (coded to allow it to be held in reverse
  * priority order).  However, it is occasionally borrowed for other purposes.  It
@@ -313,6 +1009,71 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
 		
 	#if ( configUSE_EDF_SCHEDULER == 1 )
 				TickType_t xTaskPeriod; /*< Stores the period in tick of the task. > */
+				TickType_t xTaskRelativeDeadline; /*< The deadline of each job in ticks from its release, no longer than xTaskPeriod. */
+				TickType_t xTaskReleaseTime; /*< The tick at which the current job of the task was released. */
+				TickType_t xTaskAbsoluteDeadline; /*< The absolute deadline, in ticks, of the current job of the task. */
+				uint32_t ulEDFMissCount; /*< Number of jobs of the task that missed their deadline. */
+				TickType_t xEDFWorstLateness; /*< Largest number of ticks by which a job completed, or was seen running, after its deadline. */
+				TickType_t xEDFLastMissTick; /*< Tick at which the last miss was recorded. */
+				uint8_t ucEDFMissRecorded; /*< pdTRUE once the miss of the current job has been counted, so it is counted once. */
+				uint32_t ulEDFPreemptionCount; /*< Number of times the task was switched out while still ready. */
+
+		#if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+				uint64_t ullEDFWorstLateness; /*< xEDFWorstLateness in portGET_HIGH_RES_TIMESTAMP() counts. */
+		#endif
+				UBaseType_t uxEDFTieKey; /*< Orders the task against ready tasks with the same deadline, see configEDF_TIE_BREAK. */
+
+		#if ( configEDF_NUMBER_OF_CORES > 1 )
+				BaseType_t xEDFCore; /*< The core the task is pinned to, set by xTaskCreatePeriodicOnCore(). */
+		#endif
+
+		#if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+				BaseType_t xEDFLastCore;       /*< The core the task last ran on, taskEDF_NOT_RUNNING before it first runs. */
+				uint32_t ulEDFMigrationCount;  /*< Number of times the task was switched in on another core than it last ran on. */
+		#endif
+
+		#if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+				configRUN_TIME_COUNTER_TYPE ulEDFJobRunTime;  /*< Run time counter units used by the current job up to the last switch out. */
+				configRUN_TIME_COUNTER_TYPE ulEDFBudget;      /*< Run time counter units allowed per job, or 0 for no enforcement. */
+				configRUN_TIME_COUNTER_TYPE ulEDFBudgetLimit; /*< Value of ulEDFJobRunTime at which the current job runs out of budget. */
+				uint8_t ucEDFBudgetPolicy;                    /*< The eTaskBudgetPolicy applied when the budget runs out. */
+				uint8_t ucEDFBudgetExhausted;                 /*< pdTRUE once the policy has been applied to the current job. */
+		#endif
+
+		#if ( configUSE_EDF_JOB_HISTOGRAMS == 1 )
+				TaskHistograms_t xEDFHistograms; /*< Jobs of the task counted by response time and lateness. */
+		#endif
+
+		#if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+				uint32_t ulEDFLoadWindow;                             /*< Number of the window ulEDFWindowRunTime is counted in. */
+				configRUN_TIME_COUNTER_TYPE ulEDFWindowRunTime;     /*< Run time counter units the task ran in window ulEDFLoadWindow so far. */
+				configRUN_TIME_COUNTER_TYPE ulEDFLastWindowRunTime; /*< Run time counter units the task ran in the window before it. */
+		#endif
+
+		#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+				uint32_t ulEDFDensity; /*< The share of taskEDF_DENSITY_ONE reserved for the task when it was admitted. */
+		#endif
+
+		#if ( configUSE_EDF_QPA_ADMISSION == 1 )
+				UBaseType_t uxEDFAdmittedIndex; /*< Position of the task in xEDFAdmittedTasks, or taskEDF_NOT_ADMITTED. */
+		#endif
+
+		#if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+				UBaseType_t uxEDFHeapIndex; /*< Position of the task in pxEDFReadyHeap, or taskEDF_NOT_IN_READY_HEAP. */
+		#endif
+
+		#if ( configUSE_EDF_CBS == 1 )
+				struct tskEDF_SERVER * pxEDFServer; /*< The server the task is attached to, or NULL for a periodic task. */
+		#endif
+
+		#if ( configUSE_EDF_SRP == 1 )
+				uint8_t ucEDFJobStarted; /*< pdTRUE once the current job has been picked to run, after which the system ceiling no longer holds it back. */
+		#endif
+
+		#if ( configUSE_MUTEXES == 1 )
+				TickType_t xTaskBaseDeadline; /*< The own deadline of the task while ucEDFDeadlineInherited is set. */
+				uint8_t ucEDFDeadlineInherited; /*< pdTRUE while the task holds a mutex and runs on the earlier deadline of a task waiting for it. */
+		#endif
 	#endif
 
 
@@ -357,7 +1118,12 @@ typedef tskTCB TCB_t;
 
 /*lint -save -e956 A manual analysis and inspection has been used to determine
  * which static variables must be declared volatile. */
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+PRIVILEGED_DATA TCB_t * volatile pxCurrentTCBs[ configEDF_NUMBER_OF_CORES ] = { NULL }; /*< The task running on each core. */
+    #define pxCurrentTCB    pxCurrentTCBs[ portGET_CORE_ID() ]
+#else
 PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#endif
 
 /* Lists for ready and blocked tasks. --------------------
  * xDelayedTaskList1 and xDelayedTaskList2 could be moved to function scope but
@@ -371,28 +1137,129 @@ PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /*< Poi
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if ( configUSE_EDF_SCHEDULER == 1 )
+	#if ( ( configEDF_NUMBER_OF_CORES > 1 ) && ( configUSE_EDF_GLOBAL_SCHEDULING == 0 ) )
+PRIVILEGED_DATA static List_t xReadyTasksListsEDF[ configEDF_NUMBER_OF_CORES ]; /*< Ready tasks pinned to each core, ordered by their deadline. */
+	#else
 PRIVILEGED_DATA static List_t xReadyTasksListEDF; /*< Ready tasks ordered by their deadline. */
+	#endif
+PRIVILEGED_DATA static TickType_t xEDFLongestPeriod = ( TickType_t ) 0U; /*< Longest period of a task or server, which bounds how far past the tick count a deadline can be. */
 
-#endif
+	#if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+PRIVILEGED_DATA static TCB_t * pxEDFReadyHeap[ configEDF_MAX_READY_TASKS ]; /*< Ready tasks as a binary min-heap on deadline - the earliest deadline is at index 0. */
+PRIVILEGED_DATA static UBaseType_t uxEDFReadyHeapSize = ( UBaseType_t ) 0U;   /*< Number of tasks referenced from pxEDFReadyHeap. */
 
+		#if ( configEDF_TIE_BREAK != taskEDF_TIE_BREAK_TASK_NUMBER )
+PRIVILEGED_DATA static UBaseType_t uxEDFReadySequence = ( UBaseType_t ) 0U; /*< Tie key given to the next task to enter pxEDFReadyHeap, so equal deadlines keep their order. */
+		#endif
+	#endif
 
-#if ( INCLUDE_vTaskDelete == 1 )
+	#if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
 
-    PRIVILEGED_DATA static List_t xTasksWaitingTermination; /*< Tasks that have been deleted - but their memory not yet freed. */
-    PRIVILEGED_DATA static volatile UBaseType_t uxDeletedTasksWaitingCleanUp = ( UBaseType_t ) 0U;
+/*
+ * The state that extends portGET_HIGH_RES_TIMESTAMP() to 64 bits.  The tick
+ * writes the copy not in use, then publishes it by incrementing ulSequence, so
+ * a reader never waits for the tick, even from an interrupt that nests in it.
+ */
+typedef struct xEDF_TIMESTAMP_BASE
+{
+    uint32_t ulWraps; /*< Number of times the counter had wrapped when ulLast was read. */
+    uint32_t ulLast;  /*< The counter as read by the tick. */
+} EDFTimestampBase_t;
+
+PRIVILEGED_DATA static EDFTimestampBase_t xEDFTimestampBase[ 2 ];                /*< The copy in use is xEDFTimestampBase[ ulEDFTimestampSequence & 1 ]. */
+PRIVILEGED_DATA static volatile uint32_t ulEDFTimestampSequence = 0UL;          /*< Number of times the tick has published a new copy. */
+PRIVILEGED_DATA static uint64_t ullEDFTickTimestamp = 0ULL;                      /*< Time stamp of the last tick that advanced the tick count. */
+PRIVILEGED_DATA static TickType_t xEDFTickTimestampCount = ( TickType_t ) 0U;    /*< The tick count set by that tick. */
+	#endif
 
-#endif
+	#if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFLoadChargedTime = 0U;                           /*< Run time counter value up to which time has been charged. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFLoadSlotStart = 0U;                             /*< Run time counter value at the start of the current slot. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFLoadSlotBusy = 0U;                              /*< Time charged to tasks other than idle in the current slot. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFLoadBusy[ configEDF_LOAD_WINDOW_SLOTS ];        /*< Busy time of the last completed slots. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFLoadElapsed[ configEDF_LOAD_WINDOW_SLOTS ];     /*< Length of the last completed slots. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFLoadWindowBusy = 0U;                            /*< Sum of ulEDFLoadBusy. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFLoadWindowElapsed = 0U;                         /*< Sum of ulEDFLoadElapsed. */
+PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulEDFLoadLastWindowElapsed = 0U;                     /*< Length of the last whole window, which ulEDFLastWindowRunTime is measured over. */
+PRIVILEGED_DATA static UBaseType_t uxEDFLoadSlot = ( UBaseType_t ) 0U;                                  /*< Entry of ulEDFLoadBusy the current slot goes to when it ends. */
+PRIVILEGED_DATA static uint32_t ulEDFLoadWindow = 0UL;                                                  /*< Number of the current window, which ends when uxEDFLoadSlot wraps. */
+PRIVILEGED_DATA static TickType_t xEDFLoadSlotStartTick = ( TickType_t ) 0U;                            /*< Tick count at the start of the current slot. */
+	#endif
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+	#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+PRIVILEGED_DATA static uint32_t ulEDFTotalDensity = 0UL; /*< Sum of ulEDFDensity over the admitted tasks. */
+	#endif
 
-    PRIVILEGED_DATA static List_t xSuspendedTaskList; /*< Tasks that are currently suspended. */
+	#if ( configUSE_EDF_QPA_ADMISSION == 1 )
+PRIVILEGED_DATA static EDFAnalysisTask_t xEDFAdmittedTasks[ configEDF_MAX_ADMITTED_TASKS ]; /*< Timing of the admitted tasks that declared a WCET, as the analysis sees them. */
+PRIVILEGED_DATA static TCB_t * pxEDFAdmittedTCBs[ configEDF_MAX_ADMITTED_TASKS ];          /*< The task owning the same entry of xEDFAdmittedTasks. */
+PRIVILEGED_DATA static UBaseType_t uxEDFAdmittedTaskCount = ( UBaseType_t ) 0U;           /*< Number of entries in use in xEDFAdmittedTasks. */
+	#endif
 
-#endif
+	#if ( configUSE_EDF_CBS == 1 )
 
-/* Global POSIX errno. Its value is changed upon context switching to match
- * the errno of the currently running task. */
-#if ( configUSE_POSIX_ERRNO == 1 )
-    int FreeRTOS_errno = 0;
+/*
+ * A constant bandwidth server.  The served task runs on the server deadline,
+ * and the time it runs is taken from the remaining budget.  When the budget
+ * runs out it is refilled and the deadline is postponed by one period, so the
+ * task never gets more than xBudget ticks in any xPeriod window ahead of the
+ * periodic tasks.
+ */
+typedef struct tskEDF_SERVER
+{
+    TickType_t xBudget;                         /*< Ticks of execution the server may use per period. */
+    TickType_t xPeriod;                         /*< Period of the server, also the length of its relative deadline. */
+    configRUN_TIME_COUNTER_TYPE ulUsed;         /*< Run time counter units the served task has run, up to its last switch out. */
+    configRUN_TIME_COUNTER_TYPE ulBudgetLimit;  /*< Value of ulUsed at which the budget runs out and the deadline has to be postponed. */
+    TickType_t xDeadline;                       /*< Current absolute deadline of the server. */
+    TCB_t * pxServedTask;        /*< The attached task, or NULL. */
+    BaseType_t xActive;          /*< pdTRUE while the served task is in the Ready state. */
+} EDFServer_t;
+
+PRIVILEGED_DATA static EDFServer_t xEDFServers[ configEDF_MAX_CBS_SERVERS ]; /*< The pool the servers are created from. */
+PRIVILEGED_DATA static UBaseType_t uxEDFServerCount = ( UBaseType_t ) 0U;   /*< Number of servers created so far. */
+	#endif
+
+	#if ( configUSE_EDF_SRP == 1 )
+
+/*
+ * A resource shared under the Stack Resource Policy.  Its ceiling is the
+ * highest preemption level, that is the shortest relative deadline, of the
+ * tasks declared to use it.
+ */
+typedef struct tskEDF_RESOURCE
+{
+    TickType_t xCeiling;       /*< Shortest relative deadline of the users, or portMAX_DELAY while it has none. */
+    TCB_t * pxHolder;          /*< The task that has the resource locked, or NULL. */
+} EDFResource_t;
+
+PRIVILEGED_DATA static EDFResource_t xEDFResources[ configEDF_MAX_SRP_RESOURCES ];     /*< The pool the resources are created from. */
+PRIVILEGED_DATA static UBaseType_t uxEDFResourceCount = ( UBaseType_t ) 0U;           /*< Number of resources created so far. */
+PRIVILEGED_DATA static TickType_t xEDFCeilingStack[ configEDF_MAX_SRP_RESOURCES ];     /*< System ceiling after each lock, the current one on top.  A resource is locked at most once, so the pool size bounds the depth. */
+PRIVILEGED_DATA static EDFResource_t * pxEDFLockStack[ configEDF_MAX_SRP_RESOURCES ];  /*< The locked resources, in the order they were locked. */
+PRIVILEGED_DATA static UBaseType_t uxEDFCeilingStackDepth = ( UBaseType_t ) 0U;       /*< Number of locked resources. */
+	#endif
+
+#endif
+
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+    PRIVILEGED_DATA static List_t xTasksWaitingTermination; /*< Tasks that have been deleted - but their memory not yet freed. */
+    PRIVILEGED_DATA static volatile UBaseType_t uxDeletedTasksWaitingCleanUp = ( UBaseType_t ) 0U;
+
+#endif
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    PRIVILEGED_DATA static List_t xSuspendedTaskList; /*< Tasks that are currently suspended. */
+
+#endif
+
+/* Global POSIX errno. Its value is changed upon context switching to match
+ * the errno of the currently running task. */
+#if ( configUSE_POSIX_ERRNO == 1 )
+    int FreeRTOS_errno = 0;
 #endif
 
 /* Other file private variables. --------------------------------*/
@@ -401,11 +1268,21 @@ PRIVILEGED_DATA static volatile TickType_t xTickCount = ( TickType_t ) configINI
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning = pdFALSE;
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks = ( TickType_t ) 0U;
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configEDF_NUMBER_OF_CORES ] = { pdFALSE }; /*< A context switch held pending on each core. */
+    #define xYieldPending    xYieldPendings[ portGET_CORE_ID() ]
+#else
 PRIVILEGED_DATA static volatile BaseType_t xYieldPending = pdFALSE;
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows = ( BaseType_t ) 0;
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber = ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime = ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandles[ configEDF_NUMBER_OF_CORES ] = { NULL }; /*< The idle task of each core, created when the scheduler is started. */
+    #define xIdleTaskHandle    xIdleTaskHandles[ portGET_CORE_ID() ]
+#else
 PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle = NULL;                          /*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+#endif
 
 /* Improve support for OpenOCD. The kernel tracks Ready tasks via priority lists.
  * For tracking the state of remote threads, OpenOCD uses uxTopUsedPriority
@@ -426,7 +1303,12 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t
 
 /* Do not move these variables to function scope as doing so prevents the
  * code working with debuggers that need to remove the static qualifier. */
-    PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL;    /*< Holds the value of a timer/counter the last time a task was switched in. */
+    #if ( configEDF_NUMBER_OF_CORES > 1 )
+        PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTimes[ configEDF_NUMBER_OF_CORES ] = { 0UL }; /*< ulTaskSwitchedInTime of each core. */
+        #define ulTaskSwitchedInTime    ulTaskSwitchedInTimes[ portGET_CORE_ID() ]
+    #else
+        PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL;    /*< Holds the value of a timer/counter the last time a task was switched in. */
+    #endif
     PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTime = 0UL; /*< Holds the total amount of execution time as defined by the run time counter clock. */
 
 #endif
@@ -553,6 +1435,333 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Insert a task into, or remove a task from, the EDF ready heap, restoring the
+ * heap order by sifting.  Both are O(log n) in the number of ready tasks.  Must
+ * be called from a critical section or with the scheduler suspended, as per the
+ * ready lists.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) )
+
+    static void prvEDFReadyHeapInsert( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFReadyHeapRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Insert a task into xReadyTasksListEDF in deadline order.  This replaces
+ * vListInsert(), which orders on the raw item value and so gets the order
+ * wrong once the deadlines straddle a tick count overflow.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 0 ) )
+
+    static void prvEDFReadyListInsert( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Insert pxNewListItem into pxList behind every item whose value, taken as an
+ * absolute deadline, is not later than its own.  The wrap-safe counterpart of
+ * vListInsert() used for all the deadline ordered lists.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFListInsertByDeadline( List_t * const pxList,
+                                            ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Place a newly created task that has a phase in the delayed list, to be woken
+ * at the release of its first job.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFAddNewTaskToDelayedList( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Reserve the density of a task about to be created, in O(1).  Returns pdFAIL,
+ * and reserves nothing, if the total density would exceed taskEDF_DENSITY_ONE.
+ * For an implicit deadline task set this is the exact EDF utilization bound,
+ * and for constrained deadlines it is a sufficient form of the processor
+ * demand test.  With configUSE_EDF_QPA_ADMISSION the task is also added to the
+ * registry, and a task refused by the density test is still admitted if QPA
+ * finds the registry plus the task schedulable.
+ *
+ * pxTCB must be allocated but is not yet initialised - only the admission
+ * members are written.  It is NULL for a CBS server, which is then counted
+ * like a periodic task for good.
+ */
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+    static BaseType_t prvEDFAdmitTask( TCB_t * pxTCB,
+                                       TickType_t xPeriod,
+                                       TickType_t xRelativeDeadline,
+                                       TickType_t xWCET ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Record a deadline miss if the current job of pxTCB is still unfinished, or
+ * has just finished, at tick xNow after its deadline.  O(1).  Called from the
+ * tick interrupt for the earliest deadline ready task, and at job completion.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFCheckDeadline( TCB_t * pxTCB,
+                                     TickType_t xNow ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called from every tick interrupt.  Count a wrap of portGET_HIGH_RES_TIMESTAMP()
+ * since the previous tick, and return the extended time stamp of this tick.
+ */
+#if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+
+    static uint64_t prvEDFTimestampTick( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * The number of portGET_HIGH_RES_TIMESTAMP() counts from xDeadline to now, for
+ * a deadline that is already in the past.
+ */
+#if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+
+    static uint64_t prvEDFHighResLateness( TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Count the job of pxTCB that completes at tick xNow in the response time and
+ * lateness histograms of the task.  O(1).  Called from xTaskDelayUntil().
+ */
+#if ( configUSE_EDF_JOB_HISTOGRAMS == 1 )
+
+    static void prvEDFRecordJob( TCB_t * pxTCB,
+                                 TickType_t xNow ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * The histogram bucket of a number of ticks: 0 for 0, otherwise the number of
+ * significant bits, capped to the last bucket.
+ */
+#if ( configUSE_EDF_JOB_HISTOGRAMS == 1 )
+
+    static UBaseType_t prvEDFHistogramBucket( TickType_t xTicks ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Move a Ready task whose deadline has just changed to its new place in the
+ * EDF ready queue.  Must be called from a critical section or with the
+ * scheduler suspended.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFRequeueReadyTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * The functions by which each core schedules its tasks when there are several
+ * cores.  prvEDFSelectTaskForCore() returns the task core xCoreID is to run:
+ * the earliest deadline ready task pinned to it, or with global scheduling the
+ * earliest no other core is running, else its idle task.  prvEDFRunningCore()
+ * returns the core pxTCB is running on, or taskEDF_NOT_RUNNING.
+ * prvEDFPreemptCore() is taskEDF_PREEMPTS_CURRENT() for pxTCB, just made ready:
+ * it compares it with the task running on the core it is pinned to, or with
+ * global scheduling on an idle core or else the core running the latest
+ * deadline, and if that is another core it interrupts that core itself and
+ * returns pdFALSE, so the caller only ever switches its own core.
+ * prvEDFYieldRunningCore() interrupts the core pxTCB is running on if that is
+ * another core, and prvEDFYieldPendingCores() interrupts every other core that
+ * held a context switch pending while the scheduler was suspended.
+ */
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+
+    static TCB_t * prvEDFSelectTaskForCore( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvEDFRunningCore( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvEDFPreemptCore( const TCB_t * pxTCB,
+                                         BaseType_t xOrTies ) PRIVILEGED_FUNCTION;
+    static void prvEDFYieldRunningCore( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFYieldPendingCores( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * With global scheduling: the earliest deadline ready task that is not running
+ * on a core other than xCoreID, or NULL, found from the head of the shared
+ * ready list past at most configEDF_NUMBER_OF_CORES - 1 running tasks; and the
+ * core a job that becomes ready is to preempt, which is an idle core, the
+ * calling one first, else the core whose running job has the latest deadline.
+ * After a core has switched, prvEDFPushWaitingTask() has the earliest ready job
+ * no core is running preempt that core if it is earlier, so several jobs that
+ * became ready together spread over the cores.
+ */
+#if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+
+    static TCB_t * prvEDFGetEarliestNotRunningElsewhere( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvEDFLatestDeadlineCore( void ) PRIVILEGED_FUNCTION;
+    static void prvEDFPushWaitingTask( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Move the deadline of the idle task to taskEDF_IDLE_DEADLINE().  The idle task
+ * does this on each pass of its loop, and when it comes back from a tickless
+ * sleep, as its deadline must keep moving with the tick count to stay behind
+ * the deadlines of new jobs.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_IDLE_SENTINEL == 0 ) )
+
+    static void prvEDFRefreshIdleDeadline( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Select the next task with configUSE_EDF_PRIORITY_BANDS.  The highest priority
+ * ready task is run if it is above configEDF_BAND_PRIORITY, otherwise the
+ * earliest deadline job of the band, and if the band has none the highest
+ * priority ready task below it.  The idle task at the bottom is always ready.
+ */
+#if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+
+    static void prvEDFSelectBandedTask( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called from the tick with taskEDF_TIE_BREAK_ROUND_ROBIN.  If another ready job
+ * has the same deadline as the running one, the running task is moved behind
+ * it and pdTRUE is returned so the tick switches to it.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_ROUND_ROBIN ) )
+
+    static BaseType_t prvEDFRotateEqualDeadlines( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called from the tick interrupt.  If the running job has used up its budget,
+ * apply the budget policy of its task and return pdTRUE, as the current task
+ * may no longer be the one to run.
+ */
+#if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+
+    static BaseType_t prvEDFEnforceBudget( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Charge the time since the last charge, up to ulNow, to pxTCB and, unless it
+ * is the idle task, to the busy time of the current slot.  Called as a task is
+ * switched out and at the end of each slot.
+ */
+#if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+
+    static void prvEDFChargeLoad( TCB_t * pxTCB,
+                                  configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Move the window counter of pxTCB to the current window, keeping the time of
+ * the window just before it and dropping anything older.
+ */
+#if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+
+    static void prvEDFRollLoadWindow( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called from the tick interrupt.  Close the current slot once it is
+ * configEDF_LOAD_SLOT_TICKS long, putting it in place of the oldest slot of the
+ * window.
+ */
+#if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+
+    static void prvEDFLoadTick( TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Apply the CBS wake up rule to the server of pxTCB if the server was idle,
+ * then give pxTCB the server deadline.  Called as a served task is added to the
+ * ready queue.
+ */
+#if ( configUSE_EDF_CBS == 1 )
+
+    static void prvEDFServerActivate( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called from the tick interrupt.  Check the time the running task has run
+ * against the budget of its server, and return pdTRUE if the server deadline
+ * had to be postponed.
+ */
+#if ( configUSE_EDF_CBS == 1 )
+
+    static BaseType_t prvEDFServerConsumeTick( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * The earliest deadline ready task that SRP lets run.  The head of the ready
+ * queue is returned in O(1) unless it is held back by the system ceiling, in
+ * which case the ready queue is searched, which can only happen while a
+ * resource is locked.
+ */
+#if ( configUSE_EDF_SRP == 1 )
+
+    static TCB_t * prvEDFSRPSelectTask( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * The EDF forms of xTaskPriorityInherit(), xTaskPriorityDisinherit() and
+ * vTaskPriorityDisinheritAfterTimeout().  Priorities mean nothing to the EDF
+ * scheduler, so a mutex holder inherits the deadline of the waiting task
+ * instead.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+    static BaseType_t prvEDFDeadlineInherit( TCB_t * const pxMutexHolderTCB ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvEDFDeadlineDisinherit( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvEDFDeadlineDisinheritAfterTimeout( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Change the priority a task runs at for priority inheritance with
+ * configUSE_EDF_PRIORITY_BANDS, moving it to the ready list of the new
+ * priority, or into or out of the EDF ready queue, if it is Ready.  Used when
+ * the mutex holder or the waiter is outside the EDF band, where the holder
+ * inherits the priority of the waiter as it would without EDF.
+ */
+#if ( ( configUSE_EDF_PRIORITY_BANDS == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+    static void prvEDFBandSetPriority( TCB_t * const pxTCB,
+                                       UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Give back what prvEDFAdmitTask() reserved for a task being deleted.  Must be
+ * called from a critical section.
+ */
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+    static void prvEDFReleaseTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 /*
@@ -564,6 +1773,19 @@ static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
 #endif
 
+/*
+ * Helper function used by vTaskListHistograms() to write the name of a task,
+ * a letter for the kind of histogram, then the count of each bucket.
+ */
+#if ( ( configUSE_EDF_JOB_HISTOGRAMS == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    static char * prvWriteHistogramToBuffer( char * pcBuffer,
+                                             const char * pcTaskName,
+                                             char cKind,
+                                             const uint32_t * pulCounts ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Called after a Task_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -750,7 +1972,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 /*-----------------------------------------------------------*/
 
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
-	#if ( configUSE_EDF_SCHEDULER == 0 )
+	#if ( ( configUSE_EDF_SCHEDULER == 0 ) || ( configUSE_EDF_PRIORITY_BANDS == 1 ) )
     BaseType_t xTaskCreate( TaskFunction_t pxTaskCode,
                             const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
                             const configSTACK_DEPTH_TYPE usStackDepth,
@@ -828,6 +2050,19 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
             prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                {
+                    /* A task of a fixed priority band has no period and no
+                     * deadline.  Its one job is released now, so it is ready
+                     * straight away and is never seen as late. */
+                    configASSERT( taskEDF_IN_EDF_BAND( pxNewTCB ) == pdFALSE );
+                    pxNewTCB->xTaskPeriod = ( TickType_t ) 0U;
+                    pxNewTCB->xTaskRelativeDeadline = ( TickType_t ) 0U;
+                    taskEDF_RELEASE_JOB( pxNewTCB, xTaskGetTickCount() );
+                }
+            #endif
+
             prvAddNewTaskToReadyList( pxNewTCB );
             xReturn = pdPASS;
         }
@@ -838,24 +2073,39 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
         return xReturn;
     }
+	#endif /* ( configUSE_EDF_SCHEDULER == 0 ) || ( configUSE_EDF_PRIORITY_BANDS == 1 ) */
 		
 		
 		/************************************************************************************************************************
 		***********************************************************************************************************************
 		****************************** New Function made by me to help me in creating task with period member *******************
 		*****************************************************************************************************************************/
-		#else
-		  BaseType_t xTaskCreatePeriodic( TaskFunction_t pxTaskCode,
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		  BaseType_t xTaskCreatePeriodicOnCore( TaskFunction_t pxTaskCode,
                             const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
                             const configSTACK_DEPTH_TYPE usStackDepth,
                             void * const pvParameters,
                             UBaseType_t uxPriority,
                             TaskHandle_t * const pxCreatedTask,
-                            TickType_t period )
+                            TickType_t period,
+                            TickType_t xRelativeDeadline,
+                            TickType_t xPhase,
+                            TickType_t xWCET,
+                            BaseType_t xCoreID )
     {
         TCB_t * pxNewTCB;
         BaseType_t xReturn;
-				TickType_t currentTick;
+
+        #if ( ( configUSE_EDF_ADMISSION_CONTROL == 0 ) && ( configUSE_EDF_BUDGET_ENFORCEMENT == 0 ) )
+            ( void ) xWCET;
+        #endif
+
+        configASSERT( ( xCoreID >= ( BaseType_t ) 0 ) && ( xCoreID < ( BaseType_t ) configEDF_NUMBER_OF_CORES ) );
+
+        #if ( configEDF_NUMBER_OF_CORES == 1 )
+            ( void ) xCoreID;
+        #endif
+
         /* If the stack grows down then allocate the stack then the TCB so the stack
          * does not grow into the TCB.  Likewise if the stack grows up then allocate
          * the TCB then the stack. */
@@ -913,6 +2163,23 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             }
         #endif /* portSTACK_GROWTH */
 
+        #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+            {
+                configASSERT( ( xRelativeDeadline > ( TickType_t ) 0U ) && ( xWCET <= xRelativeDeadline ) );
+
+                /* Admission needs the TCB for the registry, so it is done once
+                 * the memory is allocated.  A refused task is freed before
+                 * anything else can see it. */
+                if( ( pxNewTCB != NULL ) && ( prvEDFAdmitTask( pxNewTCB, period, xRelativeDeadline, xWCET ) == pdFAIL ) )
+                {
+                    vPortFreeStack( pxNewTCB->pxStack );
+                    vPortFree( pxNewTCB );
+
+                    return errEDF_TASK_NOT_ADMITTED;
+                }
+            }
+        #endif
+
         if( pxNewTCB != NULL )
         {
             #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e9029 !e731 Macro has been consolidated for readability reasons. */
@@ -924,12 +2191,42 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
             prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+
+            #if ( configEDF_NUMBER_OF_CORES > 1 )
+                {
+                    /* Pinned before it is queued, as the core picks its
+                     * ready list. */
+                    pxNewTCB->xEDFCore = xCoreID;
+                }
+            #endif
+
             /*E.C. : initialize the period */
             pxNewTCB->xTaskPeriod = period;
             /*E.C. : insert the period value in the generic list iteam before to add the task in RL: */
 					
-            currentTick =xTaskGetTickCount();
-            listSET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem ), ( pxNewTCB)->xTaskPeriod + currentTick);
+            configASSERT( period <= taskEDF_DEADLINE_HORIZON );
+            configASSERT( ( xRelativeDeadline > ( TickType_t ) 0U ) && ( xRelativeDeadline <= period ) );
+            configASSERT( xPhase <= taskEDF_DEADLINE_HORIZON );
+            pxNewTCB->xTaskRelativeDeadline = xRelativeDeadline;
+
+            if( period > xEDFLongestPeriod )
+            {
+                xEDFLongestPeriod = period;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+                {
+                    pxNewTCB->ulEDFBudget = ( configRUN_TIME_COUNTER_TYPE ) xWCET * ( configRUN_TIME_COUNTER_TYPE ) configEDF_RUN_TIME_COUNTS_PER_TICK;
+                }
+            #endif
+
+            /* With a phase the first job is released later, and the task
+             * waits in the delayed list until then. */
+            taskEDF_RELEASE_JOB( pxNewTCB, xTaskGetTickCount() + xPhase );
             prvAddNewTaskToReadyList( pxNewTCB );
             xReturn = pdPASS;
         }
@@ -940,6 +2237,36 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
         return xReturn;
     }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskCreatePeriodicConstrained( TaskFunction_t pxTaskCode,
+                                               const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                               const configSTACK_DEPTH_TYPE usStackDepth,
+                                               void * const pvParameters,
+                                               UBaseType_t uxPriority,
+                                               TaskHandle_t * const pxCreatedTask,
+                                               TickType_t period,
+                                               TickType_t xRelativeDeadline,
+                                               TickType_t xPhase,
+                                               TickType_t xWCET )
+    {
+        /* Pinned to the first core, the only one unless there are more. */
+        return xTaskCreatePeriodicOnCore( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, period, xRelativeDeadline, xPhase, xWCET, ( BaseType_t ) 0 );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskCreatePeriodic( TaskFunction_t pxTaskCode,
+                                    const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                    const configSTACK_DEPTH_TYPE usStackDepth,
+                                    void * const pvParameters,
+                                    UBaseType_t uxPriority,
+                                    TaskHandle_t * const pxCreatedTask,
+                                    TickType_t period )
+    {
+        /* Implicit deadline, released straight away, and no WCET declared so
+         * the task is not counted by the admission control. */
+        return xTaskCreatePeriodicConstrained( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, period, period, ( TickType_t ) 0U, ( TickType_t ) 0U );
+    }
 		
 #endif
 		
@@ -1069,9 +2396,84 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
     vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
-    /* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
-     * back to  the containing TCB from a generic item in a list. */
-    listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            pxNewTCB->ulEDFMissCount = 0UL;
+            pxNewTCB->xEDFWorstLateness = ( TickType_t ) 0U;
+            pxNewTCB->xEDFLastMissTick = ( TickType_t ) 0U;
+            pxNewTCB->ucEDFMissRecorded = pdFALSE;
+            pxNewTCB->ulEDFPreemptionCount = 0UL;
+
+            #if ( configEDF_NUMBER_OF_CORES > 1 )
+                {
+                    pxNewTCB->xEDFCore = ( BaseType_t ) 0;
+                }
+            #endif
+
+            #if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+                {
+                    pxNewTCB->xEDFLastCore = taskEDF_NOT_RUNNING;
+                    pxNewTCB->ulEDFMigrationCount = 0UL;
+                }
+            #endif
+        }
+    #endif
+
+    #if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+        {
+            pxNewTCB->ullEDFWorstLateness = 0ULL;
+        }
+    #endif
+
+    #if ( configUSE_EDF_JOB_HISTOGRAMS == 1 )
+        {
+            ( void ) memset( ( void * ) &( pxNewTCB->xEDFHistograms ), 0x00, sizeof( pxNewTCB->xEDFHistograms ) );
+        }
+    #endif
+
+    #if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+        {
+            pxNewTCB->ulEDFLoadWindow = ulEDFLoadWindow;
+            pxNewTCB->ulEDFWindowRunTime = 0U;
+            pxNewTCB->ulEDFLastWindowRunTime = 0U;
+        }
+    #endif
+
+    #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+        {
+            pxNewTCB->ulEDFBudget = 0U;
+            pxNewTCB->ucEDFBudgetPolicy = ( uint8_t ) configEDF_DEFAULT_BUDGET_POLICY;
+            taskEDF_START_JOB_ACCOUNTING( pxNewTCB );
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) )
+        {
+            pxNewTCB->uxEDFHeapIndex = taskEDF_NOT_IN_READY_HEAP;
+        }
+    #endif
+
+    #if ( configUSE_EDF_CBS == 1 )
+        {
+            pxNewTCB->pxEDFServer = NULL;
+        }
+    #endif
+
+    #if ( configUSE_EDF_SRP == 1 )
+        {
+            pxNewTCB->ucEDFJobStarted = pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) )
+        {
+            pxNewTCB->ucEDFDeadlineInherited = pdFALSE;
+        }
+    #endif
+
+    /* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
+     * back to  the containing TCB from a generic item in a list. */
+    listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
 
     /* Event lists are always in priority order. */
     listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
@@ -1246,7 +2648,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 }
                 #else
                 {
-                    if (listGET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem )) <= listGET_LIST_ITEM_VALUE( &( ( pxCurrentTCB )->xStateListItem )))
+                    /* A task whose first release is still to come cannot be
+                     * the first to run. */
+                    if( ( taskEDF_IS_RELEASED( pxNewTCB ) != pdFALSE ) &&
+                        ( taskEDF_DEADLINE_IS_BEFORE_OR_AT( taskEDF_GET_DEADLINE( pxNewTCB ), taskEDF_GET_DEADLINE( pxCurrentTCB ) ) ) )
                     {
                         pxCurrentTCB = pxNewTCB;
                     }
@@ -1271,9 +2676,24 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 pxNewTCB->uxTCBNumber = uxTaskNumber;
             }
         #endif /* configUSE_TRACE_FACILITY */
+
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                pxNewTCB->uxEDFTieKey = uxTaskNumber;
+            }
+        #endif
         traceTASK_CREATE( pxNewTCB );
 
-        prvAddTaskToReadyList( pxNewTCB );
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            if( taskEDF_IS_RELEASED( pxNewTCB ) == pdFALSE )
+            {
+                prvEDFAddNewTaskToDelayedList( pxNewTCB );
+            }
+            else
+        #endif
+        {
+            prvAddTaskToReadyList( pxNewTCB );
+        }
 
         portSETUP_TCB( pxNewTCB );
     }
@@ -1296,8 +2716,8 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         }
         #else
         {
-            
-            if (listGET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem )) <= listGET_LIST_ITEM_VALUE( &( ( pxCurrentTCB )->xStateListItem )))
+            if( ( taskEDF_IS_RELEASED( pxNewTCB ) != pdFALSE ) &&
+                ( taskEDF_PREEMPTS_CURRENT_OR_TIES( pxNewTCB ) ) )
             {
                 taskYIELD_IF_USING_PREEMPTION();
             }
@@ -1321,6 +2741,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     void vTaskDelete( TaskHandle_t xTaskToDelete )
     {
         TCB_t * pxTCB;
+        BaseType_t xRunning;
 
         taskENTER_CRITICAL();
         {
@@ -1328,6 +2749,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
              * being deleted. */
             pxTCB = prvGetTCBFromHandle( xTaskToDelete );
 
+            /* With several cores the task may be running on another one, and
+             * is then freed by the idle task as if it deleted itself. */
+            xRunning = taskTASK_IS_RUNNING( pxTCB );
+
             /* Remove task from the ready/delayed list. */
             if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
             {
@@ -1338,6 +2763,8 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            prvRemoveTaskFromReadyHeap( pxTCB );
+
             /* Is the task waiting on an event also? */
             if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
             {
@@ -1348,13 +2775,37 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+                {
+                    /* The processor time reserved for the task is free again. */
+                    prvEDFReleaseTask( pxTCB );
+                }
+            #endif
+
+            #if ( configUSE_EDF_CBS == 1 )
+                {
+                    /* The server keeps its reservation and can take another
+                     * task. */
+                    if( pxTCB->pxEDFServer != NULL )
+                    {
+                        pxTCB->pxEDFServer->pxServedTask = NULL;
+                        pxTCB->pxEDFServer->xActive = pdFALSE;
+                        pxTCB->pxEDFServer = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
              * not return. */
             uxTaskNumber++;
 
-            if( pxTCB == pxCurrentTCB )
+            if( xRunning != pdFALSE )
             {
                 /* A task is deleting itself.  This cannot complete within the
                  * task itself, as a context switch to another task is required.
@@ -1378,6 +2829,12 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                  * hence xYieldPending is used to latch that a context switch is
                  * required. */
                 portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+
+                #if ( configEDF_NUMBER_OF_CORES > 1 )
+                    {
+                        prvEDFYieldRunningCore( pxTCB );
+                    }
+                #endif
             }
             else
             {
@@ -1394,7 +2851,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         /* If the task is not deleting itself, call prvDeleteTCB from outside of
          * critical section. If a task deletes itself, prvDeleteTCB is called
          * from prvCheckTasksWaitingTermination which is called from Idle task. */
-        if( pxTCB != pxCurrentTCB )
+        if( xRunning == pdFALSE )
         {
             prvDeleteTCB( pxTCB );
         }
@@ -1439,6 +2896,19 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             /* Generate the tick time at which the task wants to wake. */
             xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
 
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                {
+                    /* The calling task has completed its current job. */
+                    prvEDFCheckDeadline( pxCurrentTCB, xConstTickCount );
+                }
+            #endif
+
+            #if ( configUSE_EDF_JOB_HISTOGRAMS == 1 )
+                {
+                    prvEDFRecordJob( pxCurrentTCB, xConstTickCount );
+                }
+            #endif
+
             if( xConstTickCount < *pxPreviousWakeTime )
             {
                 /* The tick count has overflowed since this function was
@@ -1483,7 +2953,52 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        /* The job overran its period, so the next job was
+                         * already released at xTimeToWake and the task stays
+                         * ready.  Re-queue it on the new deadline - unless the
+                         * kernel has released a later job meanwhile, as it does
+                         * for a task held back by its budget, in which case the
+                         * task simply carries on with that job. */
+                        if( taskEDF_DEADLINE_IS_BEFORE( pxCurrentTCB->xTaskReleaseTime, xTimeToWake ) )
+                        {
+                            #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+                                const TickType_t xPreviousDeadline = taskEDF_GET_OWN_DEADLINE( pxCurrentTCB );
+                            #endif
+
+                            taskEDF_RELEASE_JOB( pxCurrentTCB, xTimeToWake );
+
+                            #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+                                {
+                                    /* A job that is catching up must not get an
+                                     * earlier deadline than the one its budget
+                                     * policy gave the job before it, or overruns
+                                     * would escape the enforcement. */
+                                    if( ( pxCurrentTCB->ulEDFBudget != 0U ) &&
+                                        ( taskEDF_DEADLINE_IS_BEFORE( taskEDF_GET_OWN_DEADLINE( pxCurrentTCB ), xPreviousDeadline ) ) )
+                                    {
+                                        taskEDF_SET_OWN_DEADLINE( pxCurrentTCB, xPreviousDeadline );
+                                    }
+                                    else
+                                    {
+                                        mtCOVERAGE_TEST_MARKER();
+                                    }
+                                }
+                            #endif
+
+                            prvEDFRequeueReadyTask( pxCurrentTCB );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                #endif
             }
         }
         xAlreadyYielded = xTaskResumeAll();
@@ -1560,9 +3075,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
         configASSERT( pxTCB );
 
-        if( pxTCB == pxCurrentTCB )
+        if( taskTASK_IS_RUNNING( pxTCB ) != pdFALSE )
         {
-            /* The task calling this function is querying its own state. */
+            /* The task calling this function is querying its own state, or
+             * that of a task running on another core. */
             eReturn = eRunning;
         }
         else
@@ -1816,22 +3332,54 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     }
                 #endif /* if ( configUSE_MUTEXES == 1 ) */
 
+                #if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+                    {
+                        /* A periodic task keeps the deadline of its current
+                         * job, which is released whatever its priority.  A task
+                         * created without a period still has the deadline of
+                         * its creation, which may be older than
+                         * taskEDF_DEADLINE_HORIZON and then compare as far in
+                         * the future, so it is given one due now instead. */
+                        if( ( uxPriorityUsedOnEntry != ( UBaseType_t ) configEDF_BAND_PRIORITY ) &&
+                            ( taskEDF_IN_EDF_BAND( pxTCB ) != pdFALSE ) &&
+                            ( pxTCB->xTaskPeriod == ( TickType_t ) 0U ) )
+                        {
+                            taskEDF_SET_OWN_DEADLINE( pxTCB, xTickCount );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif
+
                 /* Only reset the event list item value if the value is not
-                 * being used for anything else. */
-                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-                {
-                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                 * being used for anything else.  Event lists ordered by deadline
+                 * do not use the priority, and a task waiting in one must keep
+                 * the deadline it was inserted with. */
+                #if ( configUSE_EDF_DEADLINE_EVENT_LISTS == 0 )
+                    {
+                        if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                        {
+                            listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif
 
                 /* If the task is in the blocked or suspended list we need do
                  * nothing more than change its priority variable. However, if
                  * the task is in a ready list it needs to be removed and placed
                  * in the list appropriate to its new priority. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                if( ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                #if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+                    /* The task may be moving into or out of the EDF band. */
+                    || ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxTCB->xStateListItem ) ) != pdFALSE )
+                #endif
+                    )
                 {
                     /* The task is currently in its ready list - remove before
                      * adding it to its new ready list.  As we are in a critical
@@ -1848,6 +3396,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                         mtCOVERAGE_TEST_MARKER();
                     }
 
+                    prvRemoveTaskFromReadyHeap( pxTCB );
                     prvAddTaskToReadyList( pxTCB );
                 }
                 else
@@ -1900,6 +3449,9 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            prvRemoveTaskFromReadyHeap( pxTCB );
+            taskEDF_SERVER_DEACTIVATE( pxTCB );
+
             /* Is the task waiting on an event also? */
             if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
             {
@@ -1927,6 +3479,13 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     }
                 }
             #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+
+            #if ( configEDF_NUMBER_OF_CORES > 1 )
+                {
+                    /* A task running on another core is switched out there. */
+                    prvEDFYieldRunningCore( pxTCB );
+                }
+            #endif
         }
         taskEXIT_CRITICAL();
 
@@ -2052,7 +3611,11 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     prvAddTaskToReadyList( pxTCB );
 
                     /* A higher priority task may have just been resumed. */
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( taskEDF_PREEMPTS_CURRENT( pxTCB ) )
+                #else
                     if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                #endif
                     {
                         /* This yield may not cause the task just resumed to run,
                          * but will leave the lists in the correct state for the
@@ -2120,7 +3683,11 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 {
                     /* Ready lists can be accessed so move the task from the
                      * suspended list to the ready list directly. */
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( taskEDF_PREEMPTS_CURRENT( pxTCB ) )
+                #else
                     if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                #endif
                     {
                         xYieldRequired = pdTRUE;
 
@@ -2195,15 +3762,50 @@ void vTaskStartScheduler( void )
 					
 					#if (configUSE_EDF_SCHEDULER == 1)
 					{
-						 TickType_t initIDLEPeriod = 1000;
-						
+						 /* The idle task has no jobs.  A period of one tick only
+						  * keeps a resource ceiling from ever holding it back - its
+						  * deadline is kept behind every job by
+						  * prvEDFRefreshIdleDeadline() instead, unless it is the
+						  * sentinel and has no place in the EDF ready queue. */
+						 #if ( configEDF_NUMBER_OF_CORES > 1 )
+						 {
+							 BaseType_t xCoreID;
+
+							 /* Each core has an idle task of its own, pinned to
+							  * it, which it runs when none of its tasks are ready. */
+							 xReturn = pdPASS;
+
+							 for( xCoreID = ( BaseType_t ) 0; ( xCoreID < ( BaseType_t ) configEDF_NUMBER_OF_CORES ) && ( xReturn == pdPASS ); xCoreID++ )
+							 {
+								 xReturn = xTaskCreatePeriodicOnCore( prvIdleTask,
+                                                                      "IDLE",
+                                                                      configMINIMAL_STACK_SIZE,
+                                                                      ( void * ) NULL,
+                                                                      ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
+                                                                      &( xIdleTaskHandles[ xCoreID ] ),
+                                                                      ( TickType_t ) 1U,
+                                                                      ( TickType_t ) 1U,
+                                                                      ( TickType_t ) 0U,
+                                                                      ( TickType_t ) 0U,
+                                                                      xCoreID );
+							 }
+						 }
+						 #else
 						 xReturn = xTaskCreatePeriodic( prvIdleTask,
                                                         "IDLE",
                                                         configMINIMAL_STACK_SIZE,
                                                         (void * ) NULL,
                                                         ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ),
-                                                        NULL,
-                                                        initIDLEPeriod );
+                                                        &xIdleTaskHandle,
+                                                        ( TickType_t ) 1U );
+						 #endif
+
+						 #if ( configEDF_IDLE_SENTINEL == 0 )
+						 if( xReturn == pdPASS )
+						 {
+							 prvEDFRefreshIdleDeadline();
+						 }
+						 #endif
 					}
 					
 					#else
@@ -2261,7 +3863,46 @@ void vTaskStartScheduler( void )
             }
         #endif /* configUSE_NEWLIB_REENTRANT */
 
-        xNextTaskUnblockTime = portMAX_DELAY;
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                /* Tasks created with a phase are already in the delayed list,
+                 * and the first task to run must be one that is released. */
+                prvResetNextTaskUnblockTime();
+
+                #if ( configEDF_NUMBER_OF_CORES > 1 )
+                    {
+                        BaseType_t xCoreID;
+
+                        /* Every core starts with the first task it is to run.  The
+                         * task made current while they were created is not
+                         * running yet, and must not be passed over. */
+                        for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configEDF_NUMBER_OF_CORES; xCoreID++ )
+                        {
+                            pxCurrentTCBs[ xCoreID ] = NULL;
+                        }
+
+                        for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configEDF_NUMBER_OF_CORES; xCoreID++ )
+                        {
+                            pxCurrentTCBs[ xCoreID ] = prvEDFSelectTaskForCore( xCoreID );
+
+                            #if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+                                {
+                                    pxCurrentTCBs[ xCoreID ]->xEDFLastCore = xCoreID;
+                                }
+                            #endif
+                        }
+                    }
+                #else
+                    {
+                        taskSELECT_EARLIEST_DEADLINE_TASK();
+                    }
+                #endif
+            }
+        #else
+            {
+                xNextTaskUnblockTime = portMAX_DELAY;
+            }
+        #endif
         xSchedulerRunning = pdTRUE;
         xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 
@@ -2273,6 +3914,19 @@ void vTaskStartScheduler( void )
          * FreeRTOSConfig.h file. */
         portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
 
+        #if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+            {
+                /* The first slot starts with the first task. */
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulEDFLoadSlotStart );
+                #else
+                    ulEDFLoadSlotStart = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+                ulEDFLoadChargedTime = ulEDFLoadSlotStart;
+                xEDFLoadSlotStartTick = xTickCount;
+            }
+        #endif
+
         traceTASK_SWITCHED_IN();
 
         /* Setting up the timer tick is hardware specific and thus in the
@@ -2342,6 +3996,34 @@ void vTaskSuspendAll( void )
     static TickType_t prvGetExpectedIdleTime( void )
     {
         TickType_t xReturn;
+
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            /* The idle task only runs when no job is ready, and then every
+             * periodic task waits in the delayed list for its next release, so
+             * the next release is xNextTaskUnblockTime.  Priorities and
+             * uxTopReadyPriority mean nothing here. */
+            if( pxCurrentTCB != xIdleTaskHandle )
+            {
+                xReturn = 0;
+            }
+            else if( listCURRENT_LIST_LENGTH( &xReadyTasksListEDF ) > ( UBaseType_t ) ( ( configEDF_IDLE_SENTINEL == 1 ) ? 0 : 1 ) )
+            {
+                /* A job is ready but has not preempted the idle task yet.  The
+                 * idle task is in the queue itself unless it is the sentinel. */
+                xReturn = 0;
+            }
+            else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) ( ( configEDF_IDLE_SENTINEL == 1 ) ? 1 : 0 ) )
+            {
+                /* A task of a fixed priority band shares the idle priority. */
+                xReturn = 0;
+            }
+            else
+            {
+                xReturn = xNextTaskUnblockTime - xTickCount;
+            }
+        }
+    #else /* if ( configUSE_EDF_SCHEDULER == 1 ) */
         UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
 
         /* uxHigherPriorityReadyTasks takes care of the case where
@@ -2393,6 +4075,7 @@ void vTaskSuspendAll( void )
         {
             xReturn = xNextTaskUnblockTime - xTickCount;
         }
+    #endif /* if ( configUSE_EDF_SCHEDULER == 1 ) */
 
         return xReturn;
     }
@@ -2434,7 +4117,11 @@ BaseType_t xTaskResumeAll( void )
 
                     /* If the moved task has a priority higher than or equal to
                      * the current task then a yield must be performed. */
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( taskEDF_PREEMPTS_CURRENT( pxTCB ) )
+                #else
                     if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                #endif
                     {
                         xYieldPending = pdTRUE;
                     }
@@ -2486,6 +4173,14 @@ BaseType_t xTaskResumeAll( void )
                     }
                 }
 
+                #if ( configEDF_NUMBER_OF_CORES > 1 )
+                    {
+                        /* The other cores that were asked to switch while the
+                         * scheduler was suspended can do so now. */
+                        prvEDFYieldPendingCores();
+                    }
+                #endif
+
                 if( xYieldPending != pdFALSE )
                 {
                     #if ( configUSE_PREEMPTION != 0 )
@@ -2732,6 +4427,19 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
                     uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
                 } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        BaseType_t xList;
+
+                        /* Ready EDF jobs are in the deadline ordered lists, not
+                         * in pxReadyTasksLists. */
+                        for( xList = ( BaseType_t ) 0; xList < ( BaseType_t ) taskEDF_READY_LIST_COUNT; xList++ )
+                        {
+                            uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), taskEDF_CORE_READY_LIST( xList ), eReady );
+                        }
+                    }
+                #endif
+
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Blocked state. */
                 uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
@@ -2890,7 +4598,11 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                         /* Preemption is on, but a context switch should only be
                          * performed if the unblocked task has a priority that is
                          * higher than the currently executing task. */
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        if( taskEDF_PREEMPTS_CURRENT( pxTCB ) )
+                    #else
                         if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    #endif
                         {
                             /* Pend the yield to be performed when the scheduler
                              * is unsuspended. */
@@ -2921,7 +4633,12 @@ BaseType_t xTaskIncrementTick( void )
     TCB_t * pxTCB;
     TickType_t xItemValue;
     BaseType_t xSwitchRequired = pdFALSE;
-		TickType_t currentTick;
+
+    #if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+        /* Even while the scheduler is suspended, so no wrap is missed. */
+        const uint64_t ullTimestamp = prvEDFTimestampTick();
+    #endif
+
     /* Called by the portable layer each time a tick interrupt occurs.
      * Increments the tick then checks to see if the new tick value will cause any
      * tasks to be unblocked. */
@@ -2937,6 +4654,15 @@ BaseType_t xTaskIncrementTick( void )
          * delayed lists if it wraps to 0. */
         xTickCount = xConstTickCount;
 
+        #if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+            {
+                /* Ties the tick count to the time stamps, for the lateness of
+                 * deadlines given in ticks. */
+                ullEDFTickTimestamp = ullTimestamp;
+                xEDFTickTimestampCount = xConstTickCount;
+            }
+        #endif
+
         if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
         {
             taskSWITCH_DELAYED_LISTS();
@@ -3006,8 +4732,9 @@ BaseType_t xTaskIncrementTick( void )
                      * list. */
 										#if (configUSE_EDF_SCHEDULER == 1)
 										{
-											currentTick = xTaskGetTickCount();
-											listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( pxTCB)->xTaskPeriod + currentTick);
+											/* xItemValue is the wake time the task asked for,
+											 * which is the release instant of its next job. */
+											taskEDF_RELEASE_JOB( pxTCB, xItemValue );
 										}
 										#endif
                     prvAddTaskToReadyList( pxTCB );
@@ -3030,7 +4757,7 @@ BaseType_t xTaskIncrementTick( void )
                                 mtCOVERAGE_TEST_MARKER();
                             }
                         #elif (configUSE_EDF_SCHEDULER == 1)
-                            if( listGET_LIST_ITEM_VALUE( &( ( pxCurrentTCB )->xStateListItem ) ) >= listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) )  )
+                            if( taskEDF_PREEMPTS_CURRENT_OR_TIES( pxTCB ) )
                             {
                                 xSwitchRequired = pdTRUE;
                             }
@@ -3045,12 +4772,42 @@ BaseType_t xTaskIncrementTick( void )
             }
         }
 
-        /* Tasks of equal priority to the currently running task will share
-         * processing time (time slice) if preemption is on, and the application
-         * writer has not explicitly turned time slicing off. */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        #if ( configUSE_EDF_SCHEDULER == 1 )
             {
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                BaseType_t xList;
+
+                /* Only the earliest deadline ready task is checked, so the cost
+                 * does not grow with the number of tasks.  Every other ready
+                 * task has a later deadline, so a miss of one of them is seen
+                 * once it is the earliest, or when its job completes.  The tick
+                 * runs on one core, which checks the ready list of each. */
+                for( xList = ( BaseType_t ) 0; xList < ( BaseType_t ) taskEDF_READY_LIST_COUNT; xList++ )
+                {
+                    pxTCB = taskEDF_GET_EARLIEST_READY_TASK_ON( xList );
+
+                    /* The idle task has no jobs, and its deadline only trails the
+                     * tick count, which it may fall behind in a tickless sleep. */
+                    if( ( pxTCB != NULL ) && ( taskEDF_IS_IDLE_TASK( pxTCB ) == pdFALSE ) )
+                    {
+                        prvEDFCheckDeadline( pxTCB, xConstTickCount );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+        #endif /* configUSE_EDF_SCHEDULER */
+
+        #if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+            {
+                prvEDFLoadTick( xConstTickCount );
+            }
+        #endif
+
+        #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+            {
+                if( prvEDFEnforceBudget() != pdFALSE )
                 {
                     xSwitchRequired = pdTRUE;
                 }
@@ -3059,26 +4816,29 @@ BaseType_t xTaskIncrementTick( void )
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+        #endif /* configUSE_EDF_BUDGET_ENFORCEMENT */
 
-        #if ( configUSE_TICK_HOOK == 1 )
+        #if ( configUSE_EDF_CBS == 1 )
             {
-                /* Guard against the tick hook being called when the pended tick
-                 * count is being unwound (when the scheduler is being unlocked). */
-                if( xPendedTicks == ( TickType_t ) 0 )
+                if( prvEDFServerConsumeTick() != pdFALSE )
                 {
-                    vApplicationTickHook();
+                    xSwitchRequired = pdTRUE;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-        #endif /* configUSE_TICK_HOOK */
+        #endif /* configUSE_EDF_CBS */
 
-        #if ( configUSE_PREEMPTION == 1 )
+        /* Tasks of equal priority to the currently running task will share
+         * processing time (time slice) if preemption is on, and the application
+         * writer has not explicitly turned time slicing off.  With priority
+         * bands this is the case outside the EDF band, whose own ready list is
+         * always empty. */
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) && ( ( configUSE_EDF_SCHEDULER == 0 ) || ( configUSE_EDF_PRIORITY_BANDS == 1 ) ) )
             {
-                if( xYieldPending != pdFALSE )
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
                 {
                     xSwitchRequired = pdTRUE;
                 }
@@ -3087,21 +4847,64 @@ BaseType_t xTaskIncrementTick( void )
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-        #endif /* configUSE_PREEMPTION */
-    }
-    else
-    {
-        ++xPendedTicks;
+        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) && ( ( configUSE_EDF_SCHEDULER == 0 ) || ( configUSE_EDF_PRIORITY_BANDS == 1 ) ) ) */
 
-        /* The tick hook gets called at regular intervals, even if the
-         * scheduler is locked. */
-        #if ( configUSE_TICK_HOOK == 1 )
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_ROUND_ROBIN ) )
             {
-                vApplicationTickHook();
-            }
-        #endif
-    }
-
+                /* The EDF time slice is only shared with jobs that have the same
+                 * deadline as the running one. */
+                if( prvEDFRotateEqualDeadlines() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        #if ( configUSE_TICK_HOOK == 1 )
+            {
+                /* Guard against the tick hook being called when the pended tick
+                 * count is being unwound (when the scheduler is being unlocked). */
+                if( xPendedTicks == ( TickType_t ) 0 )
+                {
+                    vApplicationTickHook();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_TICK_HOOK */
+
+        #if ( configUSE_PREEMPTION == 1 )
+            {
+                if( xYieldPending != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_PREEMPTION */
+    }
+    else
+    {
+        ++xPendedTicks;
+
+        /* The tick hook gets called at regular intervals, even if the
+         * scheduler is locked. */
+        #if ( configUSE_TICK_HOOK == 1 )
+            {
+                vApplicationTickHook();
+            }
+        #endif
+    }
+
     return xSwitchRequired;
 }
 /*-----------------------------------------------------------*/
@@ -3249,12 +5052,41 @@ void vTaskSwitchContext( void )
                 if( ulTotalRunTime > ulTaskSwitchedInTime )
                 {
                     pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+
+                    #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+                        {
+                            /* The same time is charged to the current job. */
+                            pxCurrentTCB->ulEDFJobRunTime += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                        }
+                    #endif
+
+                    #if ( configUSE_EDF_CBS == 1 )
+                        {
+                            /* And to the budget of its server, even if the task
+                             * has just blocked, so a task that only runs for
+                             * part of each tick is charged too. */
+                            if( pxCurrentTCB->pxEDFServer != NULL )
+                            {
+                                pxCurrentTCB->pxEDFServer->ulUsed += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #endif
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
 
+                #if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+                    {
+                        prvEDFChargeLoad( pxCurrentTCB, ulTotalRunTime );
+                    }
+                #endif
+
                 ulTaskSwitchedInTime = ulTotalRunTime;
             }
         #endif /* configGENERATE_RUN_TIME_STATS */
@@ -3278,7 +5110,52 @@ void vTaskSwitchContext( void )
                 }
                 #else
 				{
-					pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &(xReadyTasksListEDF ) );
+					TCB_t * const pxPreviousTCB = pxCurrentTCB;
+
+					taskSELECT_EARLIEST_DEADLINE_TASK();
+
+					/* A task switched out while it is still in a ready list was
+					 * preempted, rather than blocked or suspended.  The idle
+					 * task gives way to every job and is not counted. */
+					if( ( pxPreviousTCB != pxCurrentTCB ) &&
+					    ( pxPreviousTCB != xIdleTaskHandle ) &&
+					    ( ( listIS_CONTAINED_WITHIN( taskEDF_READY_LIST( pxPreviousTCB ), &( pxPreviousTCB->xStateListItem ) ) != pdFALSE ) ||
+					      ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxPreviousTCB->uxPriority ] ), &( pxPreviousTCB->xStateListItem ) ) != pdFALSE ) ) )
+					{
+						( pxPreviousTCB->ulEDFPreemptionCount )++;
+						traceTASK_PREEMPTED( pxPreviousTCB );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					#if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+					{
+						if( pxCurrentTCB->xEDFLastCore != portGET_CORE_ID() )
+						{
+							if( pxCurrentTCB->xEDFLastCore != taskEDF_NOT_RUNNING )
+							{
+								( pxCurrentTCB->ulEDFMigrationCount )++;
+								traceTASK_MIGRATED( pxCurrentTCB );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+
+							pxCurrentTCB->xEDFLastCore = portGET_CORE_ID();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						/* A job preempted here, or released for a core that
+						 * took another one, goes to the next latest core. */
+						prvEDFPushWaitingTask();
+					}
+					#endif
 				}
 				
 				#endif
@@ -3323,7 +5200,20 @@ void vTaskPlaceOnEventList( List_t * const pxEventList,
      *
      * The queue that contains the event list is locked, preventing
      * simultaneous access from interrupts. */
-    vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+    #if ( configUSE_EDF_DEADLINE_EVENT_LISTS == 1 )
+        {
+            /* Key the waiter by the deadline it runs under instead, so the head
+             * of the list is always the most urgent waiter.  The value is only
+             * read while the item is in this list, so it does not have to be
+             * kept up to date afterwards. */
+            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), taskEDF_EVENT_LIST_KEY( pxCurrentTCB ) );
+            prvEDFListInsertByDeadline( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        }
+    #else
+        {
+            vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        }
+    #endif
 
     prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 }
@@ -3438,7 +5328,11 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
         listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
     }
 
+#if ( configUSE_EDF_SCHEDULER == 1 )
+    if( taskEDF_PREEMPTS_CURRENT( pxUnblockedTCB ) )
+#else
     if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+#endif
     {
         /* Return true if the task removed from the event list has a higher
          * priority than the calling task.  This allows the calling task to know if
@@ -3496,7 +5390,11 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
     listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
     prvAddTaskToReadyList( pxUnblockedTCB );
 
+#if ( configUSE_EDF_SCHEDULER == 1 )
+    if( taskEDF_PREEMPTS_CURRENT( pxUnblockedTCB ) )
+#else
     if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+#endif
     {
         /* The unblocked task has a priority above that of the calling task, so
          * a context switch is required.  This function is called with the
@@ -3687,8 +5585,9 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
                  * A critical region is not required here as we are just reading from
                  * the list, and an occasional incorrect value will not matter.  If
                  * the ready list at the idle priority contains more than one task
-                 * then a task other than the idle task is ready to execute. */
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+                 * then a task other than the idle task is ready to execute.  With
+                 * several cores it holds the idle task of each. */
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configEDF_NUMBER_OF_CORES )
                 {
                     taskYIELD();
                 }
@@ -3747,6 +5646,15 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
                             traceLOW_POWER_IDLE_BEGIN();
                             portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
                             traceLOW_POWER_IDLE_END();
+
+                            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_IDLE_SENTINEL == 0 ) )
+                                {
+                                    /* The tick count may have moved past the idle
+                                     * deadline while asleep.  Refresh it before the
+                                     * tasks woken meanwhile are compared with it. */
+                                    prvEDFRefreshIdleDeadline();
+                                }
+                            #endif
                         }
                         else
                         {
@@ -3764,11 +5672,20 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
         #endif /* configUSE_TICKLESS_IDLE */
 				
 				
-				#if ( configUSE_EDF_SCHEDULER == 1 )
+				#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_IDLE_SENTINEL == 0 ) )
                     {
-                        TickType_t xIDLEPeriod = ( prvGetTCBFromHandle(xIdleTaskHandle) )->xTaskPeriod ;
-                        //xTickCount = xTaskGetTickCount();
-                        listSET_LIST_ITEM_VALUE( &( ( prvGetTCBFromHandle(xIdleTaskHandle) )->xStateListItem ), xIDLEPeriod + xTickCount );
+                        prvEDFRefreshIdleDeadline();
+
+                        /* A job made ready while the idle deadline was stale may
+                         * not have preempted it. */
+                        if( taskEDF_GET_EARLIEST_READY_TASK() != pxCurrentTCB )
+                        {
+                            taskYIELD();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
 				#endif	
     }
@@ -3911,7 +5828,12 @@ static void prvInitialiseTaskLists( void )
 				
 		#if ( configUSE_EDF_SCHEDULER == 1 )
             {
-                vListInitialise( &xReadyTasksListEDF ); /*initlize ready list for edf option if enabled*/
+                BaseType_t xList;
+
+                for( xList = ( BaseType_t ) 0; xList < ( BaseType_t ) taskEDF_READY_LIST_COUNT; xList++ )
+                {
+                    vListInitialise( taskEDF_CORE_READY_LIST( xList ) ); /*initlize ready list for edf option if enabled*/
+                }
             }
 		#endif
 				 
@@ -3937,12 +5859,40 @@ static void prvCheckTasksWaitingTermination( void )
                 taskENTER_CRITICAL();
                 {
                     pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    --uxCurrentNumberOfTasks;
-                    --uxDeletedTasksWaitingCleanUp;
+
+                    #if ( configEDF_NUMBER_OF_CORES > 1 )
+                        {
+                            /* A task deleted while running on another core is
+                             * only freed once that core has switched it out. */
+                            if( taskTASK_IS_RUNNING( pxTCB ) != pdFALSE )
+                            {
+                                pxTCB = NULL;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #endif
+
+                    if( pxTCB != NULL )
+                    {
+                        ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                        --uxCurrentNumberOfTasks;
+                        --uxDeletedTasksWaitingCleanUp;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 taskEXIT_CRITICAL();
 
+                if( pxTCB == NULL )
+                {
+                    break;
+                }
+
                 prvDeleteTCB( pxTCB );
             }
         }
@@ -3993,7 +5943,7 @@ static void prvCheckTasksWaitingTermination( void )
          * state is just set to whatever is passed in. */
         if( eState != eInvalid )
         {
-            if( pxTCB == pxCurrentTCB )
+            if( taskTASK_IS_RUNNING( pxTCB ) != pdFALSE )
             {
                 pxTaskStatus->eCurrentState = eRunning;
             }
@@ -4124,131 +6074,2088 @@ static void prvCheckTasksWaitingTermination( void )
          * backward compatibility for applications that expect an 8-bit return
          * type. */
 
-        pxTCB = prvGetTCBFromHandle( xTask );
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        #if portSTACK_GROWTH < 0
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            }
+        #else
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            }
+        #endif
+
+        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+
+    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        uint8_t * pucEndOfStack;
+        UBaseType_t uxReturn;
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        #if portSTACK_GROWTH < 0
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            }
+        #else
+            {
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            }
+        #endif
+
+        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+    static void prvDeleteTCB( TCB_t * pxTCB )
+    {
+        /* This call is required specifically for the TriCore port.  It must be
+         * above the vPortFree() calls.  The call is also used by ports/demos that
+         * want to allocate and clean RAM statically. */
+        portCLEAN_UP_TCB( pxTCB );
+
+        /* Free up the memory allocated by the scheduler for the task.  It is up
+         * to the task to free any memory allocated at the application level.
+         * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
+         * for additional information. */
+        #if ( configUSE_NEWLIB_REENTRANT == 1 )
+            {
+                _reclaim_reent( &( pxTCB->xNewLib_reent ) );
+            }
+        #endif /* configUSE_NEWLIB_REENTRANT */
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+            {
+                /* The task can only have been allocated dynamically - free both
+                 * the stack and TCB. */
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFree( pxTCB );
+            }
+        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+            {
+                /* The task could have been allocated statically or dynamically, so
+                 * check what was statically allocated before trying to free the
+                 * memory. */
+                if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+                {
+                    /* Both the stack and TCB were allocated dynamically, so both
+                     * must be freed. */
+                    vPortFreeStack( pxTCB->pxStack );
+                    vPortFree( pxTCB );
+                }
+                else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+                {
+                    /* Only the stack was statically allocated, so the TCB is the
+                     * only memory that must be freed. */
+                    vPortFree( pxTCB );
+                }
+                else
+                {
+                    /* Neither the stack nor the TCB were allocated dynamically, so
+                     * nothing needs to be freed. */
+                    configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+    }
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+static void prvResetNextTaskUnblockTime( void )
+{
+    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    {
+        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+         * the maximum possible value so it is  extremely unlikely that the
+         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+         * there is an item in the delayed list. */
+        xNextTaskUnblockTime = portMAX_DELAY;
+    }
+    else
+    {
+        /* The new current delayed list is not empty, get the value of
+         * the item at the head of the delayed list.  This is the time at
+         * which the task at the head of the delayed list should be removed
+         * from the Blocked state. */
+        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) )
+
+    static void prvEDFReadyHeapInsert( TCB_t * pxTCB )
+    {
+        UBaseType_t uxIndex, uxParent;
+
+        configASSERT( pxTCB->uxEDFHeapIndex == taskEDF_NOT_IN_READY_HEAP );
+        configASSERT( uxEDFReadyHeapSize < ( UBaseType_t ) configEDF_MAX_READY_TASKS );
+
+        /* Start at the first free leaf and move parents with a later deadline
+         * down until the slot for the new task is found. */
+        uxIndex = uxEDFReadyHeapSize;
+        uxEDFReadyHeapSize++;
+
+        while( uxIndex > ( UBaseType_t ) 0U )
+        {
+            uxParent = ( uxIndex - ( UBaseType_t ) 1U ) >> 1;
+
+            if( taskEDF_RUNS_BEFORE( pxTCB, pxEDFReadyHeap[ uxParent ] ) )
+            {
+                pxEDFReadyHeap[ uxIndex ] = pxEDFReadyHeap[ uxParent ];
+                pxEDFReadyHeap[ uxIndex ]->uxEDFHeapIndex = uxIndex;
+                uxIndex = uxParent;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        pxEDFReadyHeap[ uxIndex ] = pxTCB;
+        pxTCB->uxEDFHeapIndex = uxIndex;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFReadyHeapRemove( TCB_t * pxTCB )
+    {
+        UBaseType_t uxIndex, uxParent, uxChild;
+        TCB_t * pxLast;
+
+        uxIndex = pxTCB->uxEDFHeapIndex;
+
+        if( uxIndex == taskEDF_NOT_IN_READY_HEAP )
+        {
+            /* The task was in a delayed, suspended or termination list. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+        else
+        {
+            configASSERT( pxEDFReadyHeap[ uxIndex ] == pxTCB );
+
+            pxTCB->uxEDFHeapIndex = taskEDF_NOT_IN_READY_HEAP;
+            uxEDFReadyHeapSize--;
+
+            if( uxIndex != uxEDFReadyHeapSize )
+            {
+                /* Fill the hole with the last leaf, which may then have to move
+                 * either up or down to restore the heap order. */
+                pxLast = pxEDFReadyHeap[ uxEDFReadyHeapSize ];
+
+                while( uxIndex > ( UBaseType_t ) 0U )
+                {
+                    uxParent = ( uxIndex - ( UBaseType_t ) 1U ) >> 1;
+
+                    if( taskEDF_RUNS_BEFORE( pxLast, pxEDFReadyHeap[ uxParent ] ) )
+                    {
+                        pxEDFReadyHeap[ uxIndex ] = pxEDFReadyHeap[ uxParent ];
+                        pxEDFReadyHeap[ uxIndex ]->uxEDFHeapIndex = uxIndex;
+                        uxIndex = uxParent;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                for( ; ; )
+                {
+                    uxChild = ( uxIndex << 1 ) + ( UBaseType_t ) 1U;
+
+                    if( uxChild >= uxEDFReadyHeapSize )
+                    {
+                        break;
+                    }
+
+                    /* Follow the child with the earlier deadline. */
+                    if( ( ( uxChild + ( UBaseType_t ) 1U ) < uxEDFReadyHeapSize ) &&
+                        ( taskEDF_RUNS_BEFORE( pxEDFReadyHeap[ uxChild + ( UBaseType_t ) 1U ], pxEDFReadyHeap[ uxChild ] ) ) )
+                    {
+                        uxChild++;
+                    }
+
+                    if( taskEDF_RUNS_BEFORE( pxEDFReadyHeap[ uxChild ], pxLast ) )
+                    {
+                        pxEDFReadyHeap[ uxIndex ] = pxEDFReadyHeap[ uxChild ];
+                        pxEDFReadyHeap[ uxIndex ]->uxEDFHeapIndex = uxIndex;
+                        uxIndex = uxChild;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                pxEDFReadyHeap[ uxIndex ] = pxLast;
+                pxLast->uxEDFHeapIndex = uxIndex;
+            }
+            else
+            {
+                /* The last leaf was removed, nothing to reorder. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 0 ) )
+
+    static void prvEDFReadyListInsert( TCB_t * pxTCB )
+    {
+        /* The item value mirrors the deadline while the task is Ready. */
+        listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xTaskAbsoluteDeadline );
+
+        prvEDFListInsertByDeadline( taskEDF_READY_LIST( pxTCB ), &( pxTCB->xStateListItem ) );
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_HEAP_READY_QUEUE == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFListInsertByDeadline( List_t * const pxList,
+                                            ListItem_t * const pxNewListItem )
+    {
+        ListItem_t const * const pxListEnd = listGET_END_MARKER( pxList );
+        const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( pxNewListItem );
+        ListItem_t * pxIterator;
+
+        /* Skip every item whose deadline is not later than the new one, so items
+         * with equal deadlines are kept in the order they were inserted, as
+         * vListInsert() did, unless they are ordered by task number. */
+        for( pxIterator = ( ListItem_t * ) pxListEnd; listGET_NEXT( pxIterator ) != pxListEnd; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            if( taskEDF_DEADLINE_IS_BEFORE( xDeadline, listGET_LIST_ITEM_VALUE( listGET_NEXT( pxIterator ) ) ) )
+            {
+                break;
+            }
+
+            #if ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_TASK_NUMBER )
+                {
+                    if( ( xDeadline == listGET_LIST_ITEM_VALUE( listGET_NEXT( pxIterator ) ) ) &&
+                        ( taskEDF_TIE_IS_BEFORE( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxNewListItem ), ( TCB_t * ) listGET_LIST_ITEM_OWNER( listGET_NEXT( pxIterator ) ) ) ) )
+                    {
+                        break;
+                    }
+                }
+            #endif
+        }
+
+        pxNewListItem->pxNext = pxIterator->pxNext;
+        pxNewListItem->pxNext->pxPrevious = pxNewListItem;
+        pxNewListItem->pxPrevious = pxIterator;
+        pxIterator->pxNext = pxNewListItem;
+
+        /* Remember which list the item is in. */
+        pxNewListItem->pxContainer = pxList;
+
+        ( pxList->uxNumberOfItems )++;
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFAddNewTaskToDelayedList( TCB_t * pxTCB )
+    {
+        const TickType_t xTimeToWake = pxTCB->xTaskReleaseTime;
+
+        /* The wake time is the release time, which xTaskIncrementTick() then
+         * uses as the release of the job, as it does for any periodic wake. */
+        listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xTimeToWake );
+
+        if( xTimeToWake < xTickCount )
+        {
+            /* The release time has overflowed. */
+            vListInsert( pxOverflowDelayedTaskList, &( pxTCB->xStateListItem ) );
+        }
+        else
+        {
+            vListInsert( pxDelayedTaskList, &( pxTCB->xStateListItem ) );
+
+            if( xTimeToWake < xNextTaskUnblockTime )
+            {
+                xNextTaskUnblockTime = xTimeToWake;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFCheckDeadline( TCB_t * pxTCB,
+                                     TickType_t xNow )
+    {
+        TickType_t xLateness;
+        const TickType_t xDeadline = taskEDF_GET_OWN_DEADLINE( pxTCB );
+
+        /* An inherited deadline belongs to another task's job, so a holder
+         * running past it is not late itself.  A task created without a
+         * period has no deadline at all. */
+        if( ( pxTCB->xTaskPeriod != ( TickType_t ) 0U ) &&
+            ( taskEDF_DEADLINE_IS_BEFORE( xDeadline, xNow ) ) )
+        {
+            xLateness = xNow - xDeadline;
+
+            /* A late job seen from the tick is checked again when it completes,
+             * by which time it is later still. */
+            if( xLateness > pxTCB->xEDFWorstLateness )
+            {
+                pxTCB->xEDFWorstLateness = xLateness;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            #if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+                {
+                    const uint64_t ullLateness = prvEDFHighResLateness( xDeadline );
+
+                    if( ullLateness > pxTCB->ullEDFWorstLateness )
+                    {
+                        pxTCB->ullEDFWorstLateness = ullLateness;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
+            if( pxTCB->ucEDFMissRecorded == pdFALSE )
+            {
+                pxTCB->ucEDFMissRecorded = pdTRUE;
+                ( pxTCB->ulEDFMissCount )++;
+                pxTCB->xEDFLastMissTick = xNow;
+
+                traceTASK_DEADLINE_MISSED( pxTCB );
+
+                #if ( configUSE_EDF_DEADLINE_MISS_HOOK == 1 )
+                    {
+                        vApplicationDeadlineMissHook( ( TaskHandle_t ) pxTCB, xLateness );
+                    }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    void vTaskGetDeadlineStats( TaskHandle_t xTask,
+                                TaskDeadlineStats_t * pxStats )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( pxStats );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            pxStats->ulMissCount = pxTCB->ulEDFMissCount;
+            pxStats->ulPreemptionCount = pxTCB->ulEDFPreemptionCount;
+
+            #if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+                {
+                    pxStats->ulMigrationCount = pxTCB->ulEDFMigrationCount;
+                }
+            #else
+                {
+                    pxStats->ulMigrationCount = 0UL;
+                }
+            #endif
+            pxStats->xWorstLateness = pxTCB->xEDFWorstLateness;
+            pxStats->xLastMissTick = pxTCB->xEDFLastMissTick;
+
+            #if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+                {
+                    pxStats->ullWorstLateness = pxTCB->ullEDFWorstLateness;
+                }
+            #else
+                {
+                    pxStats->ullWorstLateness = 0ULL;
+                }
+            #endif
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFRequeueReadyTask( TCB_t * pxTCB )
+    {
+        if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+        {
+            portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvRemoveTaskFromReadyHeap( pxTCB );
+        prvAddTaskToReadyList( pxTCB );
+
+        #if ( configEDF_NUMBER_OF_CORES > 1 )
+            {
+                /* The core the task runs on, or is pinned to, may now have to
+                 * run another task.  The calling core is left to its caller. */
+                if( prvEDFRunningCore( pxTCB ) != taskEDF_NOT_RUNNING )
+                {
+                    prvEDFYieldRunningCore( pxTCB );
+                }
+                else if( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE )
+                {
+                    xYieldPending = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+
+    static TCB_t * prvEDFSelectTaskForCore( BaseType_t xCoreID )
+    {
+        #if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+            TCB_t * pxTCB = prvEDFGetEarliestNotRunningElsewhere( xCoreID );
+        #else
+            TCB_t * pxTCB = taskEDF_GET_EARLIEST_READY_TASK_ON( xCoreID );
+        #endif
+
+        if( pxTCB == NULL )
+        {
+            pxTCB = xIdleTaskHandles[ xCoreID ];
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxTCB;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFRunningCore( const TCB_t * pxTCB )
+    {
+        BaseType_t xCoreID;
+
+        for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configEDF_NUMBER_OF_CORES; xCoreID++ )
+        {
+            if( pxCurrentTCBs[ xCoreID ] == pxTCB )
+            {
+                break;
+            }
+        }
+
+        if( xCoreID == ( BaseType_t ) configEDF_NUMBER_OF_CORES )
+        {
+            xCoreID = taskEDF_NOT_RUNNING;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xCoreID;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFPreemptCore( const TCB_t * pxTCB,
+                                         BaseType_t xOrTies )
+    {
+        #if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+            const BaseType_t xCoreID = prvEDFLatestDeadlineCore();
+        #else
+            const BaseType_t xCoreID = pxTCB->xEDFCore;
+        #endif
+        const TCB_t * const pxRunningTCB = pxCurrentTCBs[ xCoreID ];
+        BaseType_t xPreempts;
+
+        if( ( pxRunningTCB == NULL ) || ( pxRunningTCB == xIdleTaskHandles[ xCoreID ] ) )
+        {
+            xPreempts = pdTRUE;
+        }
+        else if( xOrTies != pdFALSE )
+        {
+            xPreempts = taskEDF_DEADLINE_IS_BEFORE_OR_AT( taskEDF_GET_DEADLINE( pxTCB ), taskEDF_GET_DEADLINE( pxRunningTCB ) );
+        }
+        else
+        {
+            xPreempts = taskEDF_DEADLINE_IS_BEFORE( taskEDF_GET_DEADLINE( pxTCB ), taskEDF_GET_DEADLINE( pxRunningTCB ) );
+        }
+
+        if( ( xPreempts != pdFALSE ) && ( xCoreID != portGET_CORE_ID() ) )
+        {
+            /* The other core switches in its own interrupt. */
+            if( xSchedulerRunning != pdFALSE )
+            {
+                portYIELD_CORE( xCoreID );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xPreempts = pdFALSE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xPreempts;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFYieldRunningCore( const TCB_t * pxTCB )
+    {
+        const BaseType_t xCoreID = prvEDFRunningCore( pxTCB );
+
+        if( ( xCoreID != taskEDF_NOT_RUNNING ) && ( xCoreID != portGET_CORE_ID() ) && ( xSchedulerRunning != pdFALSE ) )
+        {
+            portYIELD_CORE( xCoreID );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFYieldPendingCores( void )
+    {
+        BaseType_t xCoreID;
+
+        for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configEDF_NUMBER_OF_CORES; xCoreID++ )
+        {
+            if( ( xCoreID != portGET_CORE_ID() ) && ( xYieldPendings[ xCoreID ] != pdFALSE ) )
+            {
+                portYIELD_CORE( xCoreID );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+#endif /* configEDF_NUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_GLOBAL_SCHEDULING == 1 )
+
+    static TCB_t * prvEDFGetEarliestNotRunningElsewhere( BaseType_t xCoreID )
+    {
+        ListItem_t const * const pxListEnd = listGET_END_MARKER( &xReadyTasksListEDF );
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB = NULL;
+        BaseType_t xRunningCore;
+
+        /* The running jobs are the earliest, so at most one per other core is
+         * passed over. */
+        for( pxIterator = listGET_HEAD_ENTRY( &xReadyTasksListEDF ); pxIterator != pxListEnd; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            xRunningCore = prvEDFRunningCore( listGET_LIST_ITEM_OWNER( pxIterator ) );
+
+            if( ( xRunningCore == taskEDF_NOT_RUNNING ) || ( xRunningCore == xCoreID ) )
+            {
+                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return pxTCB;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFLatestDeadlineCore( void )
+    {
+        const BaseType_t xThisCore = portGET_CORE_ID();
+        BaseType_t xCoreID, xLatestCore = xThisCore, x;
+        const TCB_t * pxRunningTCB;
+
+        for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configEDF_NUMBER_OF_CORES; x++ )
+        {
+            /* The calling core is looked at first, so it wins ties and is
+             * switched without an interrupt. */
+            xCoreID = ( xThisCore + x ) % ( BaseType_t ) configEDF_NUMBER_OF_CORES;
+            pxRunningTCB = pxCurrentTCBs[ xCoreID ];
+
+            if( ( pxRunningTCB == NULL ) || ( pxRunningTCB == xIdleTaskHandles[ xCoreID ] ) )
+            {
+                xLatestCore = xCoreID;
+                break;
+            }
+            else if( taskEDF_DEADLINE_IS_BEFORE( taskEDF_GET_DEADLINE( pxCurrentTCBs[ xLatestCore ] ), taskEDF_GET_DEADLINE( pxRunningTCB ) ) )
+            {
+                xLatestCore = xCoreID;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xLatestCore;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFPushWaitingTask( void )
+    {
+        const TCB_t * const pxTCB = prvEDFGetEarliestNotRunningElsewhere( taskEDF_NOT_RUNNING );
+
+        /* The calling core has just taken the earliest job it could, so only
+         * another core can be preempted. */
+        if( pxTCB != NULL )
+        {
+            ( void ) prvEDFPreemptCore( pxTCB, pdFALSE );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_EDF_GLOBAL_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+
+    static void prvEDFSelectBandedTask( void )
+    {
+        TCB_t * pxEDFSelectedTCB = NULL;
+        UBaseType_t uxTopPriority;
+
+        /* Only the tasks outside the band are recorded in uxTopReadyPriority,
+         * and the ready list of the band priority itself stays empty. */
+        #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+            {
+                uxTopPriority = uxTopReadyPriority;
+
+                while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopPriority ] ) ) )
+                {
+                    configASSERT( uxTopPriority );
+                    --uxTopPriority;
+                }
+
+                uxTopReadyPriority = uxTopPriority;
+            }
+        #else
+            {
+                portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );
+            }
+        #endif
+
+        if( uxTopPriority < ( UBaseType_t ) configEDF_BAND_PRIORITY )
+        {
+            #if ( configUSE_EDF_SRP == 1 )
+                {
+                    pxEDFSelectedTCB = prvEDFSRPSelectTask();
+                }
+            #else
+                {
+                    pxEDFSelectedTCB = taskEDF_GET_EARLIEST_READY_TASK();
+                }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxEDFSelectedTCB != NULL )
+        {
+            pxCurrentTCB = pxEDFSelectedTCB;
+
+            #if ( configUSE_EDF_SRP == 1 )
+                {
+                    pxCurrentTCB->ucEDFJobStarted = pdTRUE;
+                }
+            #endif
+        }
+        else
+        {
+            /* Tasks of the same fixed priority share the processor as they do
+             * without EDF. */
+            listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );
+        }
+    }
+
+#endif /* configUSE_EDF_PRIORITY_BANDS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_IDLE_SENTINEL == 0 ) )
+
+    static void prvEDFRefreshIdleDeadline( void )
+    {
+        TCB_t * const pxIdleTCB = xIdleTaskHandle;
+        TickType_t xDeadline;
+
+        taskENTER_CRITICAL();
+        {
+            xDeadline = taskEDF_IDLE_DEADLINE();
+
+            #if ( configUSE_EDF_CBS == 1 )
+                {
+                    UBaseType_t x;
+
+                    /* A backlogged server keeps postponing its deadline, and
+                     * still has to run before the idle task. */
+                    for( x = ( UBaseType_t ) 0U; x < uxEDFServerCount; x++ )
+                    {
+                        if( ( xEDFServers[ x ].xActive != pdFALSE ) &&
+                            ( taskEDF_DEADLINE_IS_BEFORE_OR_AT( xDeadline, xEDFServers[ x ].xDeadline ) ) &&
+                            ( ( TickType_t ) ( xEDFServers[ x ].xDeadline - xTickCount ) < taskEDF_DEADLINE_HORIZON ) )
+                        {
+                            xDeadline = xEDFServers[ x ].xDeadline + ( TickType_t ) 1U;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+            #endif /* configUSE_EDF_CBS */
+
+            pxIdleTCB->xTaskAbsoluteDeadline = xDeadline;
+            prvEDFRequeueReadyTask( pxIdleTCB );
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_IDLE_SENTINEL == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_ROUND_ROBIN ) )
+
+    static BaseType_t prvEDFRotateEqualDeadlines( void )
+    {
+        TCB_t * pxNextTCB = NULL;
+        BaseType_t xRotated = pdFALSE;
+
+        #if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+            {
+                /* Every ancestor of a job with the same deadline as the root has
+                 * that deadline too, so if there is one, a child of the root is
+                 * one. */
+                if( pxCurrentTCB->uxEDFHeapIndex == ( UBaseType_t ) 0U )
+                {
+                    if( ( uxEDFReadyHeapSize > ( UBaseType_t ) 1U ) &&
+                        ( taskEDF_GET_DEADLINE( pxEDFReadyHeap[ 1 ] ) == taskEDF_GET_DEADLINE( pxCurrentTCB ) ) )
+                    {
+                        pxNextTCB = pxEDFReadyHeap[ 1 ];
+                    }
+                    else if( ( uxEDFReadyHeapSize > ( UBaseType_t ) 2U ) &&
+                             ( taskEDF_GET_DEADLINE( pxEDFReadyHeap[ 2 ] ) == taskEDF_GET_DEADLINE( pxCurrentTCB ) ) )
+                    {
+                        pxNextTCB = pxEDFReadyHeap[ 2 ];
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+        #else
+            {
+                /* Jobs with the same deadline are next to each other. */
+                if( ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) &&
+                    ( listGET_NEXT( &( pxCurrentTCB->xStateListItem ) ) != listGET_END_MARKER( &xReadyTasksListEDF ) ) )
+                {
+                    pxNextTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( listGET_NEXT( &( pxCurrentTCB->xStateListItem ) ) );
+
+                    if( taskEDF_GET_DEADLINE( pxNextTCB ) != taskEDF_GET_DEADLINE( pxCurrentTCB ) )
+                    {
+                        pxNextTCB = NULL;
+                    }
+                }
+            }
+        #endif /* configUSE_EDF_HEAP_READY_QUEUE */
+
+        if( pxNextTCB != NULL )
+        {
+            /* Re-inserting the task puts it behind every job with the same
+             * deadline. */
+            prvEDFRequeueReadyTask( pxCurrentTCB );
+            xRotated = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xRotated;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_TIE_BREAK == taskEDF_TIE_BREAK_ROUND_ROBIN ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+
+    static BaseType_t prvEDFEnforceBudget( void )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        configRUN_TIME_COUNTER_TYPE ulNow, ulUsed;
+        TickType_t xNextRelease;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* xTaskResumeAll() replays pended ticks after the running task may
+         * have blocked, in which case it is no longer ready and must be left
+         * in its delayed or event list. */
+        if( ( pxTCB->ulEDFBudget != 0U ) && ( pxTCB->ucEDFBudgetExhausted == pdFALSE ) &&
+            ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+        {
+            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+            #else
+                ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+            #endif
+
+            /* Time charged to the job so far, plus the time since it was
+             * last switched in. */
+            ulUsed = pxTCB->ulEDFJobRunTime;
+
+            if( ulNow > ulTaskSwitchedInTime )
+            {
+                ulUsed += ( ulNow - ulTaskSwitchedInTime );
+            }
+
+            if( ulUsed >= pxTCB->ulEDFBudgetLimit )
+            {
+                traceTASK_BUDGET_EXHAUSTED( pxTCB );
+
+                switch( ( eTaskBudgetPolicy ) pxTCB->ucEDFBudgetPolicy )
+                {
+                    case eTaskBudgetDemote:
+
+                        /* Let the rest of the job compete with the deadline of
+                         * the next job, one tick later so it also stays behind
+                         * the jobs due at that same time. */
+                        pxTCB->ucEDFBudgetExhausted = pdTRUE;
+                        taskEDF_SET_OWN_DEADLINE( pxTCB, pxTCB->xTaskReleaseTime + pxTCB->xTaskPeriod + pxTCB->xTaskRelativeDeadline + ( TickType_t ) 1U );
+                        prvEDFRequeueReadyTask( pxTCB );
+                        xSwitchRequired = pdTRUE;
+                        break;
+
+                    case eTaskBudgetSuspendUntilRelease:
+
+                        /* Block until the first release still to come, which
+                         * then starts a new job with a fresh budget.  The task
+                         * resumes where it stopped, and the remainder of this
+                         * job runs on the budget of the new one. */
+                        pxTCB->ucEDFBudgetExhausted = pdTRUE;
+                        xNextRelease = pxTCB->xTaskReleaseTime + pxTCB->xTaskPeriod;
+
+                        if( taskEDF_DEADLINE_IS_BEFORE( xNextRelease, xTickCount + ( TickType_t ) 1U ) )
+                        {
+                            /* The job is more than a period late. */
+                            xNextRelease += ( ( ( xTickCount - xNextRelease ) / pxTCB->xTaskPeriod ) + ( TickType_t ) 1U ) * pxTCB->xTaskPeriod;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        prvAddCurrentTaskToDelayedList( xNextRelease - xTickCount, pdFALSE );
+                        xSwitchRequired = pdTRUE;
+                        break;
+
+                    case eTaskBudgetPostponeDeadline:
+
+                        /* Refill the budget and push the deadline back by one
+                         * period, as often as needed. */
+                        pxTCB->ulEDFBudgetLimit += pxTCB->ulEDFBudget;
+                        taskEDF_SET_OWN_DEADLINE( pxTCB, taskEDF_GET_OWN_DEADLINE( pxTCB ) + pxTCB->xTaskPeriod );
+                        prvEDFRequeueReadyTask( pxTCB );
+                        xSwitchRequired = pdTRUE;
+                        break;
+
+                    case eTaskBudgetNoAction:
+                    default:
+
+                        /* Only traced. */
+                        pxTCB->ucEDFBudgetExhausted = pdTRUE;
+                        break;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetBudgetPolicy( TaskHandle_t xTask,
+                               eTaskBudgetPolicy ePolicy )
+    {
+        TCB_t * pxTCB;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            pxTCB->ucEDFBudgetPolicy = ( uint8_t ) ePolicy;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    configRUN_TIME_COUNTER_TYPE ulTaskGetJobRunTime( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        configRUN_TIME_COUNTER_TYPE ulReturn;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            ulReturn = pxTCB->ulEDFJobRunTime;
+        }
+        taskEXIT_CRITICAL();
+
+        return ulReturn;
+    }
+
+#endif /* configUSE_EDF_BUDGET_ENFORCEMENT */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+
+    static uint64_t prvEDFTimestampTick( void )
+    {
+        const EDFTimestampBase_t * const pxBase = &( xEDFTimestampBase[ ulEDFTimestampSequence & 1UL ] );
+        EDFTimestampBase_t * const pxNext = &( xEDFTimestampBase[ ( ulEDFTimestampSequence + 1UL ) & 1UL ] );
+        const uint32_t ulNow = ( uint32_t ) portGET_HIGH_RES_TIMESTAMP();
+
+        pxNext->ulWraps = pxBase->ulWraps;
+
+        if( ulNow < pxBase->ulLast )
+        {
+            ( pxNext->ulWraps )++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxNext->ulLast = ulNow;
+
+        /* Publish the new copy only once it is complete. */
+        ulEDFTimestampSequence++;
+
+        return ( ( uint64_t ) pxNext->ulWraps << 32 ) | ( uint64_t ) ulNow;
+    }
+/*-----------------------------------------------------------*/
+
+    uint64_t ullTaskGetHighResTimestamp( void )
+    {
+        uint32_t ulSequence, ulWraps, ulLast, ulNow;
+
+        /* Read the copy the tick published last, and the counter after it.  If
+         * the tick published again meanwhile the copy may have been rewritten,
+         * so read again.  This only loops when a tick comes in between. */
+        do
+        {
+            ulSequence = ulEDFTimestampSequence;
+            ulWraps = xEDFTimestampBase[ ulSequence & 1UL ].ulWraps;
+            ulLast = xEDFTimestampBase[ ulSequence & 1UL ].ulLast;
+            ulNow = ( uint32_t ) portGET_HIGH_RES_TIMESTAMP();
+        } while( ulSequence != ulEDFTimestampSequence );
+
+        /* The counter wrapped since the last tick. */
+        if( ulNow < ulLast )
+        {
+            ulWraps++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ( ( uint64_t ) ulWraps << 32 ) | ( uint64_t ) ulNow;
+    }
+/*-----------------------------------------------------------*/
+
+    static uint64_t prvEDFHighResLateness( TickType_t xDeadline )
+    {
+        /* The deadline is at a tick, which is
+         * ( xEDFTickTimestampCount - xDeadline ) ticks before the time stamp of
+         * the last tick.  The tick count can be ahead of xEDFTickTimestampCount
+         * after a tickless sleep, so the difference is signed. */
+        int64_t llTicksBefore, llLateness;
+
+        if( taskEDF_DEADLINE_IS_BEFORE( xDeadline, xEDFTickTimestampCount ) )
+        {
+            llTicksBefore = ( int64_t ) ( TickType_t ) ( xEDFTickTimestampCount - xDeadline );
+        }
+        else
+        {
+            llTicksBefore = -( int64_t ) ( TickType_t ) ( xDeadline - xEDFTickTimestampCount );
+        }
+
+        llLateness = ( int64_t ) ( ullTaskGetHighResTimestamp() - ullEDFTickTimestamp ) +
+                     ( llTicksBefore * ( int64_t ) configEDF_HIGH_RES_COUNTS_PER_TICK );
+
+        return ( llLateness > 0 ) ? ( uint64_t ) llLateness : 0ULL;
+    }
+
+#endif /* configUSE_EDF_HIGH_RES_TIMESTAMP */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_JOB_HISTOGRAMS == 1 )
+
+    static UBaseType_t prvEDFHistogramBucket( TickType_t xTicks )
+    {
+        UBaseType_t uxBucket = ( UBaseType_t ) 0U;
+
+        /* The bucket is the number of significant bits, so bucket n holds
+         * 2^(n-1) to 2^n - 1 ticks and the last one everything above.  At
+         * most configEDF_HISTOGRAM_BUCKETS - 1 steps, whatever the value. */
+        while( ( uxBucket < ( UBaseType_t ) ( configEDF_HISTOGRAM_BUCKETS - 1 ) ) &&
+               ( ( xTicks >> uxBucket ) != ( TickType_t ) 0U ) )
+        {
+            uxBucket++;
+        }
+
+        return uxBucket;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFRecordJob( TCB_t * pxTCB,
+                                 TickType_t xNow )
+    {
+        const TickType_t xDeadline = taskEDF_GET_OWN_DEADLINE( pxTCB );
+
+        /* A task created without a period has no jobs. */
+        if( pxTCB->xTaskPeriod != ( TickType_t ) 0U )
+        {
+            ( pxTCB->xEDFHistograms.ulResponseTime[ prvEDFHistogramBucket( xNow - pxTCB->xTaskReleaseTime ) ] )++;
+
+            if( taskEDF_DEADLINE_IS_BEFORE( xDeadline, xNow ) )
+            {
+                ( pxTCB->xEDFHistograms.ulLate[ prvEDFHistogramBucket( xNow - xDeadline ) ] )++;
+            }
+            else
+            {
+                ( pxTCB->xEDFHistograms.ulEarly[ prvEDFHistogramBucket( xDeadline - xNow ) ] )++;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetHistograms( TaskHandle_t xTask,
+                             TaskHistograms_t * pxHistograms )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( pxHistograms );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            ( void ) memcpy( ( void * ) pxHistograms, ( void * ) &( pxTCB->xEDFHistograms ), sizeof( TaskHistograms_t ) );
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_EDF_JOB_HISTOGRAMS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+
+    static void prvEDFRollLoadWindow( TCB_t * pxTCB )
+    {
+        if( pxTCB->ulEDFLoadWindow != ulEDFLoadWindow )
+        {
+            /* The task has not been charged since an earlier window ended.
+             * Only the window just before the current one is kept. */
+            if( pxTCB->ulEDFLoadWindow == ( ulEDFLoadWindow - 1UL ) )
+            {
+                pxTCB->ulEDFLastWindowRunTime = pxTCB->ulEDFWindowRunTime;
+            }
+            else
+            {
+                pxTCB->ulEDFLastWindowRunTime = 0U;
+            }
+
+            pxTCB->ulEDFWindowRunTime = 0U;
+            pxTCB->ulEDFLoadWindow = ulEDFLoadWindow;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFChargeLoad( TCB_t * pxTCB,
+                                  configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        /* Unsigned, so a wrap of the counter between two charges is fine. */
+        const configRUN_TIME_COUNTER_TYPE ulDelta = ulNow - ulEDFLoadChargedTime;
+
+        ulEDFLoadChargedTime = ulNow;
+
+        if( pxTCB != xIdleTaskHandle )
+        {
+            ulEDFLoadSlotBusy += ulDelta;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvEDFRollLoadWindow( pxTCB );
+        pxTCB->ulEDFWindowRunTime += ulDelta;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFLoadTick( TickType_t xConstTickCount )
+    {
+        configRUN_TIME_COUNTER_TYPE ulNow, ulElapsed;
+
+        /* Not an equality test, vTaskStepTick() may step over the end. */
+        if( ( TickType_t ) ( xConstTickCount - xEDFLoadSlotStartTick ) >= ( TickType_t ) configEDF_LOAD_SLOT_TICKS )
+        {
+            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+            #else
+                ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+            #endif
+
+            /* The running task has not been charged since it was switched in,
+             * its time so far belongs to the slot that ends here. */
+            prvEDFChargeLoad( pxCurrentTCB, ulNow );
+
+            ulElapsed = ulNow - ulEDFLoadSlotStart;
+
+            /* The slot replaces the oldest one, and the sums follow without
+             * walking the window. */
+            ulEDFLoadWindowBusy = ( ulEDFLoadWindowBusy - ulEDFLoadBusy[ uxEDFLoadSlot ] ) + ulEDFLoadSlotBusy;
+            ulEDFLoadWindowElapsed = ( ulEDFLoadWindowElapsed - ulEDFLoadElapsed[ uxEDFLoadSlot ] ) + ulElapsed;
+            ulEDFLoadBusy[ uxEDFLoadSlot ] = ulEDFLoadSlotBusy;
+            ulEDFLoadElapsed[ uxEDFLoadSlot ] = ulElapsed;
+
+            ulEDFLoadSlotBusy = 0U;
+            ulEDFLoadSlotStart = ulNow;
+            xEDFLoadSlotStartTick = xConstTickCount;
+
+            uxEDFLoadSlot++;
+
+            if( uxEDFLoadSlot == ( UBaseType_t ) configEDF_LOAD_WINDOW_SLOTS )
+            {
+                /* Every slot of the window has just been replaced, so the
+                 * window is whole.  The tasks move to the next one as they are
+                 * next charged or read. */
+                uxEDFLoadSlot = ( UBaseType_t ) 0U;
+                ulEDFLoadLastWindowElapsed = ulEDFLoadWindowElapsed;
+                ulEDFLoadWindow++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulTaskGetSystemLoad( void )
+    {
+        uint32_t ulReturn = 0UL;
+
+        taskENTER_CRITICAL();
+        {
+            if( ulEDFLoadWindowElapsed != 0U )
+            {
+                /* Only done here, never in the switch or the tick. */
+                ulReturn = ( uint32_t ) ( ( ( uint64_t ) ulEDFLoadWindowBusy * 1000U ) / ( uint64_t ) ulEDFLoadWindowElapsed );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetLoadStats( TaskHandle_t xTask,
+                            TaskLoadStats_t * pxStats )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( pxStats );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            prvEDFRollLoadWindow( pxTCB );
+
+            pxStats->ulRunTime = pxTCB->ulRunTimeCounter;
+            pxStats->ulWindowRunTime = pxTCB->ulEDFLastWindowRunTime;
+            pxStats->ulWindowLoad = 0UL;
+
+            if( ulEDFLoadLastWindowElapsed != 0U )
+            {
+                pxStats->ulWindowLoad = ( uint32_t ) ( ( ( uint64_t ) pxTCB->ulEDFLastWindowRunTime * 1000U ) / ( uint64_t ) ulEDFLoadLastWindowElapsed );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_EDF_LOAD_ACCOUNTING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_CBS == 1 )
+
+    ServerHandle_t xTaskCreateServer( TickType_t xBudget,
+                                      TickType_t xPeriod )
+    {
+        EDFServer_t * pxServer = NULL;
+        BaseType_t xAdmitted = pdPASS;
+
+        configASSERT( ( xBudget > ( TickType_t ) 0U ) && ( xBudget <= xPeriod ) );
+        configASSERT( xPeriod <= taskEDF_DEADLINE_HORIZON );
+
+        vTaskSuspendAll();
+        {
+            if( uxEDFServerCount < ( UBaseType_t ) configEDF_MAX_CBS_SERVERS )
+            {
+                #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+                    {
+                        /* A server needs no more than a periodic task with
+                         * the same budget and period.  Its reservation is
+                         * never given back, as servers are not deleted. */
+                        xAdmitted = prvEDFAdmitTask( NULL, xPeriod, xPeriod, xBudget );
+                    }
+                #endif
+
+                if( xAdmitted != pdFAIL )
+                {
+                    pxServer = &( xEDFServers[ uxEDFServerCount ] );
+                    uxEDFServerCount++;
+
+                    if( xPeriod > xEDFLongestPeriod )
+                    {
+                        xEDFLongestPeriod = xPeriod;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* The deadline is already due, so the first activation
+                     * starts a full server period. */
+                    pxServer->xBudget = xBudget;
+                    pxServer->xPeriod = xPeriod;
+                    pxServer->ulUsed = 0U;
+                    pxServer->ulBudgetLimit = taskEDF_SERVER_BUDGET( pxServer );
+                    pxServer->xDeadline = xTaskGetTickCount();
+                    pxServer->pxServedTask = NULL;
+                    pxServer->xActive = pdFALSE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return pxServer;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskAttachToServer( TaskHandle_t xTask,
+                                    ServerHandle_t xServer )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xReturn = pdFAIL;
+
+        configASSERT( xServer );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            if( ( xServer->pxServedTask == NULL ) && ( pxTCB->pxEDFServer == NULL ) )
+            {
+                xServer->pxServedTask = pxTCB;
+                xServer->xActive = pdFALSE;
+                pxTCB->pxEDFServer = xServer;
+
+                if( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    /* Already ready, so it is queued again on the deadline
+                     * the server gives it. */
+                    prvEDFRequeueReadyTask( pxTCB );
+
+                    if( ( pxTCB == pxCurrentTCB ) && ( xSchedulerRunning != pdFALSE ) )
+                    {
+                        taskYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFServerActivate( TCB_t * pxTCB )
+    {
+        EDFServer_t * const pxServer = pxTCB->pxEDFServer;
+        const TickType_t xConstTickCount = xTickCount;
+        configRUN_TIME_COUNTER_TYPE ulRemaining;
+
+        if( pxServer->xActive == pdFALSE )
+        {
+            pxServer->xActive = pdTRUE;
+
+            /* The task was not running, so ulUsed is up to date.  The time
+             * it ran since the last tick was only charged as it was switched
+             * out, and may have used up the budget, in which case the deadline
+             * is postponed now as the tick would have done. */
+            while( pxServer->ulUsed >= pxServer->ulBudgetLimit )
+            {
+                traceTASK_SERVER_POSTPONED( pxTCB );
+
+                pxServer->ulBudgetLimit += taskEDF_SERVER_BUDGET( pxServer );
+                pxServer->xDeadline += pxServer->xPeriod;
+            }
+
+            ulRemaining = pxServer->ulBudgetLimit - pxServer->ulUsed;
+
+            /* CBS wake up rule.  The remaining budget can only be used with
+             * the current deadline if that does not take more than the server
+             * bandwidth from now on, that is if c < ( d - now ) * Q / T.
+             * Otherwise a new server period starts now. */
+            if( ( taskEDF_DEADLINE_IS_BEFORE_OR_AT( pxServer->xDeadline, xConstTickCount ) ) ||
+                ( ( ( uint64_t ) ulRemaining * ( uint64_t ) pxServer->xPeriod ) >=
+                  ( ( uint64_t ) ( TickType_t ) ( pxServer->xDeadline - xConstTickCount ) * ( uint64_t ) taskEDF_SERVER_BUDGET( pxServer ) ) ) )
+            {
+                pxServer->ulBudgetLimit = pxServer->ulUsed + taskEDF_SERVER_BUDGET( pxServer );
+                pxServer->xDeadline = xConstTickCount + pxServer->xPeriod;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->xTaskReleaseTime = xConstTickCount;
+            pxTCB->ucEDFMissRecorded = pdFALSE;
+            taskEDF_SRP_NEW_JOB( pxTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskEDF_SET_OWN_DEADLINE( pxTCB, pxServer->xDeadline );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFServerConsumeTick( void )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        EDFServer_t * const pxServer = pxTCB->pxEDFServer;
+        configRUN_TIME_COUNTER_TYPE ulNow, ulUsed;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* The running task may have just blocked and be waiting for the yield,
+         * in which case its server is idle.  The time it ran is charged when it
+         * is switched out, and the budget is next looked at when it wakes. */
+        if( ( pxServer != NULL ) && ( pxServer->xActive != pdFALSE ) )
+        {
+            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+            #else
+                ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+            #endif
+
+            /* Time charged so far, plus the time since the task was last
+             * switched in. */
+            ulUsed = pxServer->ulUsed;
+
+            if( ulNow > ulTaskSwitchedInTime )
+            {
+                ulUsed += ( ulNow - ulTaskSwitchedInTime );
+            }
+
+            if( ulUsed >= pxServer->ulBudgetLimit )
+            {
+                traceTASK_SERVER_POSTPONED( pxTCB );
+
+                pxServer->ulBudgetLimit += taskEDF_SERVER_BUDGET( pxServer );
+                pxServer->xDeadline += pxServer->xPeriod;
+                pxTCB->ucEDFMissRecorded = pdFALSE;
+
+                /* Requeueing takes the new server deadline. */
+                prvEDFRequeueReadyTask( pxTCB );
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+
+#endif /* configUSE_EDF_CBS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SRP == 1 )
+
+    ResourceHandle_t xTaskCreateResource( void )
+    {
+        EDFResource_t * pxResource = NULL;
+
+        taskENTER_CRITICAL();
+        {
+            if( uxEDFResourceCount < ( UBaseType_t ) configEDF_MAX_SRP_RESOURCES )
+            {
+                pxResource = &( xEDFResources[ uxEDFResourceCount ] );
+                uxEDFResourceCount++;
+
+                pxResource->xCeiling = portMAX_DELAY;
+                pxResource->pxHolder = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return pxResource;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskDeclareResourceUse( ResourceHandle_t xResource,
+                                  TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+
+        configASSERT( xResource );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            if( pxTCB->xTaskRelativeDeadline < xResource->xCeiling )
+            {
+                xResource->xCeiling = pxTCB->xTaskRelativeDeadline;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskResourceLock( ResourceHandle_t xResource )
+    {
+        configASSERT( xResource );
+
+        taskENTER_CRITICAL();
+        {
+            /* SRP never lets a task start while a resource it uses is held, so
+             * the resource is free unless the task did not declare its use,
+             * or blocked while holding a resource. */
+            configASSERT( xResource->pxHolder == NULL );
+            configASSERT( pxCurrentTCB->xTaskRelativeDeadline >= xResource->xCeiling );
+
+            xResource->pxHolder = pxCurrentTCB;
+
+            /* A job nesting locks may take a resource with a lower ceiling
+             * than one it already holds, so the system ceiling is the highest
+             * of all the ceilings pushed, not the last one. */
+            if( ( uxEDFCeilingStackDepth != ( UBaseType_t ) 0U ) &&
+                ( xEDFCeilingStack[ uxEDFCeilingStackDepth - ( UBaseType_t ) 1U ] < xResource->xCeiling ) )
+            {
+                xEDFCeilingStack[ uxEDFCeilingStackDepth ] = xEDFCeilingStack[ uxEDFCeilingStackDepth - ( UBaseType_t ) 1U ];
+            }
+            else
+            {
+                xEDFCeilingStack[ uxEDFCeilingStackDepth ] = xResource->xCeiling;
+            }
+
+            pxEDFLockStack[ uxEDFCeilingStackDepth ] = xResource;
+            uxEDFCeilingStackDepth++;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskResourceUnlock( ResourceHandle_t xResource )
+    {
+        configASSERT( xResource );
+
+        taskENTER_CRITICAL();
+        {
+            configASSERT( xResource->pxHolder == pxCurrentTCB );
+            configASSERT( uxEDFCeilingStackDepth > ( UBaseType_t ) 0U );
+
+            /* Resources are unlocked in the reverse order of locking, so the
+             * ceiling pushed for this one is on top. */
+            configASSERT( pxEDFLockStack[ uxEDFCeilingStackDepth - ( UBaseType_t ) 1U ] == xResource );
+
+            xResource->pxHolder = NULL;
+            uxEDFCeilingStackDepth--;
+
+            /* Jobs held back by the ceiling may now be able to start. */
+            if( prvEDFSRPSelectTask() != pxCurrentTCB )
+            {
+                taskYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    static TCB_t * prvEDFSRPSelectTask( void )
+    {
+        TCB_t * pxSelected = taskEDF_GET_EARLIEST_READY_TASK();
+        TCB_t * pxTCB;
+
+        if( ( pxSelected != NULL ) && ( taskEDF_SRP_MAY_RUN( pxSelected ) == pdFALSE ) )
+        {
+            pxTCB = NULL;
+
+            #if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+                {
+                    UBaseType_t uxIndex;
+
+                    /* The heap is only ordered from parent to child, so every
+                     * entry has to be looked at. */
+                    for( uxIndex = ( UBaseType_t ) 1U; uxIndex < uxEDFReadyHeapSize; uxIndex++ )
+                    {
+                        if( ( taskEDF_SRP_MAY_RUN( pxEDFReadyHeap[ uxIndex ] ) != pdFALSE ) &&
+                            ( ( pxTCB == NULL ) ||
+                              ( taskEDF_RUNS_BEFORE( pxEDFReadyHeap[ uxIndex ], pxTCB ) ) ) )
+                        {
+                            pxTCB = pxEDFReadyHeap[ uxIndex ];
+                        }
+                    }
+                }
+            #else
+                {
+                    ListItem_t const * const pxListEnd = listGET_END_MARKER( &xReadyTasksListEDF );
+                    ListItem_t * pxIterator;
+
+                    /* The list is sorted, so the first task that may run is the
+                     * one with the earliest deadline. */
+                    for( pxIterator = listGET_NEXT( listGET_HEAD_ENTRY( &xReadyTasksListEDF ) ); pxIterator != pxListEnd; pxIterator = listGET_NEXT( pxIterator ) )
+                    {
+                        if( taskEDF_SRP_MAY_RUN( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) ) != pdFALSE )
+                        {
+                            pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+                            break;
+                        }
+                    }
+                }
+            #endif /* configUSE_EDF_HEAP_READY_QUEUE */
+
+            /* The task holding the ceiling has started, so one is always found
+             * unless a task blocked while holding a resource.  The head is then
+             * run rather than nothing. */
+            if( pxTCB != NULL )
+            {
+                pxSelected = pxTCB;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxSelected;
+    }
+
+#endif /* configUSE_EDF_SRP */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+    static BaseType_t prvEDFDeadlineInherit( TCB_t * const pxMutexHolderTCB )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        #if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+            if( ( taskEDF_IN_EDF_BAND( pxCurrentTCB ) == pdFALSE ) || ( taskEDF_IN_EDF_BAND( pxMutexHolderTCB ) == pdFALSE ) )
+            {
+                /* Deadlines can only be compared inside the band.  Otherwise
+                 * the holder inherits the priority of the waiter, which lifts
+                 * it above the band, or into it, until it gives the mutex back. */
+                if( pxMutexHolderTCB->uxPriority < pxCurrentTCB->uxPriority )
+                {
+                    /* A holder raised into the band runs on the deadline of
+                     * the waiter, not on whatever deadline it was left with
+                     * when it last ran in the band, or was created. */
+                    if( taskEDF_IN_EDF_BAND( pxCurrentTCB ) != pdFALSE )
+                    {
+                        pxMutexHolderTCB->xTaskAbsoluteDeadline = taskEDF_GET_DEADLINE( pxCurrentTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    prvEDFBandSetPriority( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+                    traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+                    xReturn = pdTRUE;
+                }
+                else if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
+                {
+                    /* Already raised by another waiter. */
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+        #endif /* configUSE_EDF_PRIORITY_BANDS */
+
+        /* If the deadline of the task attempting to obtain the mutex is earlier
+         * than that of the holder, the holder runs on it until it gives the
+         * mutex back.  The waiter may itself be running on an inherited
+         * deadline, which is so passed along a chain of holders. */
+        if( taskEDF_DEADLINE_IS_BEFORE( taskEDF_GET_DEADLINE( pxCurrentTCB ), taskEDF_GET_DEADLINE( pxMutexHolderTCB ) ) )
+        {
+            if( pxMutexHolderTCB->ucEDFDeadlineInherited == pdFALSE )
+            {
+                pxMutexHolderTCB->xTaskBaseDeadline = pxMutexHolderTCB->xTaskAbsoluteDeadline;
+                pxMutexHolderTCB->ucEDFDeadlineInherited = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxMutexHolderTCB->xTaskAbsoluteDeadline = taskEDF_GET_DEADLINE( pxCurrentTCB );
+
+            /* A ready holder is moved to its new place in the ready queue.  A
+             * blocked one is queued on the new deadline when it wakes. */
+            if( listIS_CONTAINED_WITHIN( taskEDF_READY_LIST( pxMutexHolderTCB ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+            {
+                prvEDFRequeueReadyTask( pxMutexHolderTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceTASK_DEADLINE_INHERIT( pxMutexHolderTCB, taskEDF_GET_DEADLINE( pxMutexHolderTCB ) );
+
+            /* Inheritance occurred. */
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            if( ( pxMutexHolderTCB->ucEDFDeadlineInherited != pdFALSE ) &&
+                ( taskEDF_DEADLINE_IS_BEFORE( taskEDF_GET_DEADLINE( pxCurrentTCB ), pxMutexHolderTCB->xTaskBaseDeadline ) ) )
+            {
+                /* The holder already runs on a deadline no later than this
+                 * one, inherited from another waiter, but would have inherited
+                 * this one otherwise. */
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFDeadlineDisinherit( TCB_t * const pxTCB )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        /* As for priorities, the holder gives the mutex back itself, so it is
+         * the running task. */
+        configASSERT( pxTCB == pxCurrentTCB );
+        configASSERT( pxTCB->uxMutexesHeld );
+        ( pxTCB->uxMutexesHeld )--;
+
+        /* Only disinherit if no other mutexes are held, the same
+         * simplification as the priority inheritance makes. */
+        if( ( pxTCB->ucEDFDeadlineInherited != pdFALSE ) && ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) )
+        {
+            pxTCB->ucEDFDeadlineInherited = pdFALSE;
+            pxTCB->xTaskAbsoluteDeadline = pxTCB->xTaskBaseDeadline;
+            traceTASK_DEADLINE_DISINHERIT( pxTCB, pxTCB->xTaskAbsoluteDeadline );
+            prvEDFRequeueReadyTask( pxTCB );
+
+            /* The waiter that was given the mutex, or another task, may now
+             * have the earliest deadline. */
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+            {
+                if( ( pxTCB->uxPriority != pxTCB->uxBasePriority ) && ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) )
+                {
+                    traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+                    prvEDFBandSetPriority( pxTCB, pxTCB->uxBasePriority );
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFDeadlineDisinheritAfterTimeout( TCB_t * const pxTCB )
+    {
+        configASSERT( pxTCB->uxMutexesHeld );
+
+        /* Called by a task that gave up waiting for the mutex.  The deadlines
+         * of the tasks still waiting are not known here, so the inherited
+         * deadline is only dropped if it is the one of the calling task, and
+         * if no other mutex is held. */
+        if( ( pxTCB->ucEDFDeadlineInherited != pdFALSE ) &&
+            ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 1 ) &&
+            ( taskEDF_GET_DEADLINE( pxTCB ) == taskEDF_GET_DEADLINE( pxCurrentTCB ) ) )
+        {
+            configASSERT( pxTCB != pxCurrentTCB );
+
+            pxTCB->ucEDFDeadlineInherited = pdFALSE;
+            pxTCB->xTaskAbsoluteDeadline = pxTCB->xTaskBaseDeadline;
+            traceTASK_DEADLINE_DISINHERIT( pxTCB, pxTCB->xTaskAbsoluteDeadline );
 
-        #if portSTACK_GROWTH < 0
+            if( listIS_CONTAINED_WITHIN( taskEDF_READY_LIST( pxTCB ), &( pxTCB->xStateListItem ) ) != pdFALSE )
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+                prvEDFRequeueReadyTask( pxTCB );
             }
-        #else
+            else
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+                mtCOVERAGE_TEST_MARKER();
             }
-        #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+        #if ( configUSE_EDF_PRIORITY_BANDS == 1 )
+            {
+                /* The same for a priority inherited across bands. */
+                if( ( pxTCB->uxPriority != pxTCB->uxBasePriority ) &&
+                    ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 1 ) &&
+                    ( pxTCB->uxPriority == pxCurrentTCB->uxPriority ) )
+                {
+                    configASSERT( pxTCB != pxCurrentTCB );
 
-        return uxReturn;
+                    traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+                    prvEDFBandSetPriority( pxTCB, pxTCB->uxBasePriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
     }
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+#if ( ( configUSE_EDF_PRIORITY_BANDS == 1 ) && ( configUSE_MUTEXES == 1 ) )
 
-    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    static void prvEDFBandSetPriority( TCB_t * const pxTCB,
+                                       UBaseType_t uxNewPriority )
     {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        UBaseType_t uxReturn;
-
-        pxTCB = prvGetTCBFromHandle( xTask );
-
-        #if portSTACK_GROWTH < 0
+        /* A Ready task is either in the ready list of its priority or, in the
+         * band, in the EDF ready queue.  Only then does it have to move. */
+        if( ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) ||
+            ( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+        {
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+                portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
             }
-        #else
+            else
             {
-                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+                mtCOVERAGE_TEST_MARKER();
             }
-        #endif
-
-        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
 
-        return uxReturn;
+            prvRemoveTaskFromReadyHeap( pxTCB );
+            pxTCB->uxPriority = uxNewPriority;
+            prvAddTaskToReadyList( pxTCB );
+        }
+        else
+        {
+            pxTCB->uxPriority = uxNewPriority;
+        }
     }
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+#endif /* ( configUSE_EDF_PRIORITY_BANDS == 1 ) && ( configUSE_MUTEXES == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
 
-    static void prvDeleteTCB( TCB_t * pxTCB )
+    static BaseType_t prvEDFAdmitTask( TCB_t * pxTCB,
+                                       TickType_t xPeriod,
+                                       TickType_t xRelativeDeadline,
+                                       TickType_t xWCET )
     {
-        /* This call is required specifically for the TriCore port.  It must be
-         * above the vPortFree() calls.  The call is also used by ports/demos that
-         * want to allocate and clean RAM statically. */
-        portCLEAN_UP_TCB( pxTCB );
+        BaseType_t xReturn = pdFAIL;
+        uint32_t ulDensity;
 
-        /* Free up the memory allocated by the scheduler for the task.  It is up
-         * to the task to free any memory allocated at the application level.
-         * See the third party link http://www.nadler.com/embedded/newlibAndFreeRTOS.html
-         * for additional information. */
-        #if ( configUSE_NEWLIB_REENTRANT == 1 )
-            {
-                _reclaim_reent( &( pxTCB->xNewLib_reent ) );
-            }
-        #endif /* configUSE_NEWLIB_REENTRANT */
+        /* Round up, so rounding can only make the test stricter. */
+        ulDensity = ( uint32_t ) ( ( ( ( uint64_t ) xWCET * taskEDF_DENSITY_ONE ) + ( uint64_t ) xRelativeDeadline - 1U ) / ( uint64_t ) xRelativeDeadline );
 
-        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+        if( pxTCB != NULL )
+        {
+            pxTCB->ulEDFDensity = ( uint32_t ) 0UL;
+        }
+
+        #if ( configUSE_EDF_QPA_ADMISSION == 0 )
             {
-                /* The task can only have been allocated dynamically - free both
-                 * the stack and TCB. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
+                ( void ) xPeriod;
+
+                taskENTER_CRITICAL();
+                {
+                    if( ( ulEDFTotalDensity + ulDensity ) <= taskEDF_DENSITY_ONE )
+                    {
+                        ulEDFTotalDensity += ulDensity;
+
+                        if( pxTCB != NULL )
+                        {
+                            pxTCB->ulEDFDensity = ulDensity;
+                        }
+
+                        xReturn = pdPASS;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
             }
-        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+        #else /* configUSE_EDF_QPA_ADMISSION */
             {
-                /* The task could have been allocated statically or dynamically, so
-                 * check what was statically allocated before trying to free the
-                 * memory. */
-                if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+                UBaseType_t uxIndex;
+
+                if( pxTCB != NULL )
                 {
-                    /* Both the stack and TCB were allocated dynamically, so both
-                     * must be freed. */
-                    vPortFreeStack( pxTCB->pxStack );
-                    vPortFree( pxTCB );
+                    pxTCB->uxEDFAdmittedIndex = taskEDF_NOT_ADMITTED;
                 }
-                else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+
+                if( xWCET == ( TickType_t ) 0U )
                 {
-                    /* Only the stack was statically allocated, so the TCB is the
-                     * only memory that must be freed. */
-                    vPortFree( pxTCB );
+                    /* Nothing to analyse. */
+                    xReturn = pdPASS;
                 }
                 else
                 {
-                    /* Neither the stack nor the TCB were allocated dynamically, so
-                     * nothing needs to be freed. */
-                    configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
-                    mtCOVERAGE_TEST_MARKER();
+                    /* QPA can take a while, so it runs with the scheduler
+                     * suspended rather than in a critical section.  Only tasks
+                     * create and delete tasks, so the registry cannot change
+                     * under it. */
+                    vTaskSuspendAll();
+                    {
+                        uxIndex = uxEDFAdmittedTaskCount;
+
+                        if( uxIndex < ( UBaseType_t ) configEDF_MAX_ADMITTED_TASKS )
+                        {
+                            xEDFAdmittedTasks[ uxIndex ].ulPeriod = ( uint32_t ) xPeriod;
+                            xEDFAdmittedTasks[ uxIndex ].ulDeadline = ( uint32_t ) xRelativeDeadline;
+                            xEDFAdmittedTasks[ uxIndex ].ulWCET = ( uint32_t ) xWCET;
+
+                            if( ( ( ulEDFTotalDensity + ulDensity ) <= taskEDF_DENSITY_ONE ) ||
+                                ( eEDFAnalysisQPA( xEDFAdmittedTasks, ( size_t ) uxIndex + 1U, NULL ) == eEDFSchedulable ) )
+                            {
+                                taskENTER_CRITICAL();
+                                {
+                                    pxEDFAdmittedTCBs[ uxIndex ] = pxTCB;
+                                    uxEDFAdmittedTaskCount++;
+
+                                    /* The total density may go above one
+                                     * here, after which only QPA admits. */
+                                    ulEDFTotalDensity += ulDensity;
+
+                                    if( pxTCB != NULL )
+                                    {
+                                        pxTCB->uxEDFAdmittedIndex = uxIndex;
+                                        pxTCB->ulEDFDensity = ulDensity;
+                                    }
+                                }
+                                taskEXIT_CRITICAL();
+
+                                xReturn = pdPASS;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    ( void ) xTaskResumeAll();
                 }
             }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-    }
+        #endif /* configUSE_EDF_QPA_ADMISSION */
 
-#endif /* INCLUDE_vTaskDelete */
+        return xReturn;
+    }
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    static void prvEDFReleaseTask( TCB_t * pxTCB )
     {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
-    }
-    else
-    {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+        ulEDFTotalDensity -= pxTCB->ulEDFDensity;
+        pxTCB->ulEDFDensity = ( uint32_t ) 0UL;
+
+        #if ( configUSE_EDF_QPA_ADMISSION == 1 )
+            {
+                UBaseType_t uxIndex = pxTCB->uxEDFAdmittedIndex;
+                UBaseType_t uxLast;
+
+                if( uxIndex != taskEDF_NOT_ADMITTED )
+                {
+                    /* Move the last entry into the hole, order does not matter
+                     * to the analysis. */
+                    uxLast = uxEDFAdmittedTaskCount - ( UBaseType_t ) 1U;
+                    xEDFAdmittedTasks[ uxIndex ] = xEDFAdmittedTasks[ uxLast ];
+                    pxEDFAdmittedTCBs[ uxIndex ] = pxEDFAdmittedTCBs[ uxLast ];
+                    uxEDFAdmittedTaskCount = uxLast;
+
+                    if( pxEDFAdmittedTCBs[ uxIndex ] != NULL )
+                    {
+                        pxEDFAdmittedTCBs[ uxIndex ]->uxEDFAdmittedIndex = uxIndex;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxTCB->uxEDFAdmittedIndex = taskEDF_NOT_ADMITTED;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_EDF_QPA_ADMISSION */
     }
-}
+
+#endif /* configUSE_EDF_ADMISSION_CONTROL */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
@@ -4306,6 +8213,18 @@ static void prvResetNextTaskUnblockTime( void )
         /* If the mutex was given back by an interrupt while the queue was
          * locked then the mutex holder might now be NULL.  _RB_ Is this still
          * needed as interrupts can no longer use mutexes? */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                if( pxMutexHolder != NULL )
+                {
+                    xReturn = prvEDFDeadlineInherit( pxMutexHolderTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #else /* configUSE_EDF_SCHEDULER */
         if( pxMutexHolder != NULL )
         {
             /* If the holder of the mutex has a priority below the priority of
@@ -4379,6 +8298,7 @@ static void prvResetNextTaskUnblockTime( void )
         {
             mtCOVERAGE_TEST_MARKER();
         }
+        #endif /* configUSE_EDF_SCHEDULER */
 
         return xReturn;
     }
@@ -4393,6 +8313,18 @@ static void prvResetNextTaskUnblockTime( void )
         TCB_t * const pxTCB = pxMutexHolder;
         BaseType_t xReturn = pdFALSE;
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                if( pxMutexHolder != NULL )
+                {
+                    xReturn = prvEDFDeadlineDisinherit( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #else /* configUSE_EDF_SCHEDULER */
         if( pxMutexHolder != NULL )
         {
             /* A task can only have an inherited priority if it holds the mutex.
@@ -4424,6 +8356,8 @@ static void prvResetNextTaskUnblockTime( void )
                         mtCOVERAGE_TEST_MARKER();
                     }
 
+                    prvRemoveTaskFromReadyHeap( pxTCB );
+
                     /* Disinherit the priority before adding the task into the
                      * new  ready list. */
                     traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
@@ -4459,6 +8393,7 @@ static void prvResetNextTaskUnblockTime( void )
         {
             mtCOVERAGE_TEST_MARKER();
         }
+        #endif /* configUSE_EDF_SCHEDULER */
 
         return xReturn;
     }
@@ -4472,9 +8407,26 @@ static void prvResetNextTaskUnblockTime( void )
                                               UBaseType_t uxHighestPriorityWaitingTask )
     {
         TCB_t * const pxTCB = pxMutexHolder;
-        UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
-        const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
 
+        #if ( configUSE_EDF_SCHEDULER == 0 )
+            UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
+            const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
+        #endif
+
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                ( void ) uxHighestPriorityWaitingTask;
+
+                if( pxMutexHolder != NULL )
+                {
+                    prvEDFDeadlineDisinheritAfterTimeout( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #else /* configUSE_EDF_SCHEDULER */
         if( pxMutexHolder != NULL )
         {
             /* If pxMutexHolder is not NULL then the holder must hold at least
@@ -4567,6 +8519,7 @@ static void prvResetNextTaskUnblockTime( void )
         {
             mtCOVERAGE_TEST_MARKER();
         }
+        #endif /* configUSE_EDF_SCHEDULER */
     }
 
 #endif /* configUSE_MUTEXES */
@@ -4768,6 +8721,75 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*----------------------------------------------------------*/
 
+#if ( ( configUSE_EDF_JOB_HISTOGRAMS == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    static char * prvWriteHistogramToBuffer( char * pcBuffer,
+                                             const char * pcTaskName,
+                                             char cKind,
+                                             const uint32_t * pulCounts )
+    {
+        UBaseType_t uxBucket;
+
+        pcBuffer = prvWriteNameToBuffer( pcBuffer, pcTaskName );
+        sprintf( pcBuffer, "\t%c", cKind ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+        pcBuffer += strlen( pcBuffer );     /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
+
+        for( uxBucket = 0; uxBucket < ( UBaseType_t ) configEDF_HISTOGRAM_BUCKETS; uxBucket++ )
+        {
+            sprintf( pcBuffer, "\t%u", ( unsigned int ) pulCounts[ uxBucket ] ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+            pcBuffer += strlen( pcBuffer );                                       /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
+        }
+
+        sprintf( pcBuffer, "\r\n" ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+
+        return pcBuffer + strlen( pcBuffer );
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskListHistograms( char * pcWriteBuffer )
+    {
+        TaskStatus_t * pxTaskStatusArray;
+        UBaseType_t uxArraySize, x;
+        TaskHistograms_t xHistograms;
+
+        /* As vTaskList(), this is a convenience for the demos that depends on
+         * sprintf(), and vTaskGetHistograms() gives the same counts raw. */
+
+        /* Make sure the write buffer does not contain a string. */
+        *pcWriteBuffer = ( char ) 0x00;
+
+        /* Take a snapshot of the number of tasks in case it changes while this
+         * function is executing. */
+        uxArraySize = uxCurrentNumberOfTasks;
+
+        pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+
+        if( pxTaskStatusArray != NULL )
+        {
+            uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+
+            for( x = 0; x < uxArraySize; x++ )
+            {
+                vTaskGetHistograms( pxTaskStatusArray[ x ].xHandle, &xHistograms );
+
+                /* One line per histogram: response time, then the slack of the
+                 * jobs that met their deadline, then the lateness of the rest. */
+                pcWriteBuffer = prvWriteHistogramToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName, 'R', xHistograms.ulResponseTime );
+                pcWriteBuffer = prvWriteHistogramToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName, 'E', xHistograms.ulEarly );
+                pcWriteBuffer = prvWriteHistogramToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName, 'L', xHistograms.ulLate );
+            }
+
+            vPortFree( pxTaskStatusArray );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* ( ( configUSE_EDF_JOB_HISTOGRAMS == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*----------------------------------------------------------*/
+
 #if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
     void vTaskGetRunTimeStats( char * pcWriteBuffer )
@@ -5183,7 +9205,11 @@ TickType_t uxTaskResetEventItemValue( void )
                     }
                 #endif
 
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                if( taskEDF_PREEMPTS_CURRENT( pxTCB ) )
+            #else
                 if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+            #endif
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5318,7 +9344,11 @@ TickType_t uxTaskResetEventItemValue( void )
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                if( taskEDF_PREEMPTS_CURRENT( pxTCB ) )
+            #else
                 if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+            #endif
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5409,7 +9439,11 @@ TickType_t uxTaskResetEventItemValue( void )
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                if( taskEDF_PREEMPTS_CURRENT( pxTCB ) )
+            #else
                 if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+            #endif
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5562,6 +9596,9 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
         mtCOVERAGE_TEST_MARKER();
     }
 
+    prvRemoveTaskFromReadyHeap( pxCurrentTCB );
+    taskEDF_SERVER_DEACTIVATE( pxCurrentTCB );
+
     #if ( INCLUDE_vTaskSuspend == 1 )
         {
             if( ( xTicksToWait == portMAX_DELAY ) && ( xCanBlockIndefinitely != pdFALSE ) )
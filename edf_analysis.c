@@ -0,0 +1,717 @@
+/*
+ * EDF schedulability analysis for sets of periodic tasks.
+ * See edf_analysis.h for the description of the API.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include "edf_analysis.h"
+
+/* A utilization of 1 in the 32.32 fixed point format used below. */
+#define edfUTILIZATION_ONE    ( ( uint64_t ) 1ULL << 32 )
+
+/* The longest interval that can be analysed. */
+#define edfMAX_INTERVAL       ( ( uint64_t ) UINT32_MAX )
+
+/*
+ * Compare the utilization of the task set with 1.  Returns eEDFOverloaded if it
+ * is certainly above 1, otherwise eEDFSchedulable.  Each term is rounded down,
+ * so a task set that is above 1 by less than the rounding error is not caught
+ * here - prvIntervalBound() then finds no bound and the result is eEDFNotProven.
+ */
+static eEDFAnalysisResult prvCheckUtilization( const EDFAnalysisTask_t * pxTasks,
+                                               size_t xTaskCount );
+
+/*
+ * Length of the interval that QPA has to check: a deadline miss, if any, happens
+ * at a deadline strictly before it.  That is the smaller of the synchronous busy
+ * period and of the bound L_a = max( D, sum( ( T - D ) * C / T ) / ( 1 - U ) )
+ * (Baruah et al.), or zero when there is nothing to check, because every
+ * deadline is at least the period and the utilization is at most 1.  Returns
+ * eEDFNotProven if neither bound fits in edfMAX_INTERVAL, which can only
+ * happen at a utilization of 1 or within the rounding error of it.
+ */
+static eEDFAnalysisResult prvIntervalBound( const EDFAnalysisTask_t * pxTasks,
+                                            size_t xTaskCount,
+                                            uint32_t * pulLength );
+
+/*
+ * Length of the synchronous busy period, the longest interval in which the
+ * processor is never idle once all tasks are released together.  Returns
+ * eEDFNotProven, and leaves *pulLength alone, once it grows beyond ullLimit.
+ */
+static eEDFAnalysisResult prvBusyPeriod( const EDFAnalysisTask_t * pxTasks,
+                                         size_t xTaskCount,
+                                         uint64_t ullLimit,
+                                         uint32_t * pulLength );
+
+/*
+ * The latest absolute deadline strictly before ulInterval, or 0 if no job has a
+ * deadline before then.
+ */
+static uint32_t prvLastDeadlineBefore( const EDFAnalysisTask_t * pxTasks,
+                                       size_t xTaskCount,
+                                       uint32_t ulInterval );
+
+/*
+ * Utilization of one task in the 32.32 fixed point format.
+ */
+static uint64_t prvUtilization( const EDFAnalysisTask_t * pxTask );
+
+/*
+ * The same, rounded up.
+ */
+static uint64_t prvUtilizationCeiling( const EDFAnalysisTask_t * pxTask );
+
+/*
+ * Total utilization of the tasks placed on core xCore so far.
+ */
+static uint64_t prvCoreUtilization( const EDFAnalysisTask_t * pxTasks,
+                                    size_t xTaskCount,
+                                    const size_t * pxCoreOfTask,
+                                    size_t xCore );
+
+/*
+ * Run QPA on the tasks placed on core xCore plus pxTasks[ xCandidate ], which is
+ * not placed yet.
+ */
+static eEDFAnalysisResult prvCoreQPA( const EDFAnalysisTask_t * pxTasks,
+                                      size_t xTaskCount,
+                                      const size_t * pxCoreOfTask,
+                                      size_t xCore,
+                                      size_t xCandidate,
+                                      EDFAnalysisTask_t * pxWorkspace );
+
+/*
+ * Run QPA on what the split assignment puts on core xCore so far, plus
+ * pxCandidate if it is not NULL.
+ */
+static eEDFAnalysisResult prvSplitCoreQPA( const EDFAnalysisTask_t * pxTasks,
+                                           size_t xTaskCount,
+                                           const EDFAnalysisSplit_t * pxAssignment,
+                                           size_t xCore,
+                                           const EDFAnalysisTask_t * pxCandidate,
+                                           EDFAnalysisTask_t * pxWorkspace );
+/*-----------------------------------------------------------*/
+
+uint64_t ullEDFAnalysisDemand( const EDFAnalysisTask_t * pxTasks,
+                               size_t xTaskCount,
+                               uint32_t ulInterval )
+{
+    uint64_t ullDemand = 0U;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        if( pxTasks[ x ].ulDeadline <= ulInterval )
+        {
+            ullDemand += ( ( uint64_t ) ( ( ulInterval - pxTasks[ x ].ulDeadline ) / pxTasks[ x ].ulPeriod ) + 1U ) * pxTasks[ x ].ulWCET;
+        }
+    }
+
+    return ullDemand;
+}
+/*-----------------------------------------------------------*/
+
+eEDFAnalysisResult eEDFAnalysisQPA( const EDFAnalysisTask_t * pxTasks,
+                                    size_t xTaskCount,
+                                    uint32_t * pulFailingInterval )
+{
+    eEDFAnalysisResult eResult;
+    uint32_t ulBusyPeriod = 0U, ulMinDeadline = UINT32_MAX, ulInterval = 0U;
+    uint64_t ullDemand;
+    size_t x;
+
+    eResult = eEDFSchedulable;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        if( ( pxTasks[ x ].ulPeriod == 0U ) || ( pxTasks[ x ].ulDeadline == 0U ) )
+        {
+            eResult = eEDFInvalidTaskSet;
+            break;
+        }
+
+        if( pxTasks[ x ].ulDeadline < ulMinDeadline )
+        {
+            ulMinDeadline = pxTasks[ x ].ulDeadline;
+        }
+    }
+
+    if( eResult == eEDFSchedulable )
+    {
+        eResult = prvCheckUtilization( pxTasks, xTaskCount );
+    }
+
+    if( eResult == eEDFSchedulable )
+    {
+        eResult = prvIntervalBound( pxTasks, xTaskCount, &ulBusyPeriod );
+    }
+
+    if( eResult == eEDFSchedulable )
+    {
+        /* Walk back from the last deadline in the interval.  Any interval t
+         * between h( t ) and t has h <= h( t ), so the test can jump straight to
+         * h( t ) when that is below t, and only has to step to the previous
+         * deadline when h( t ) == t.  Once h( t ) drops to the first deadline
+         * no interval left can fail. */
+        ulInterval = prvLastDeadlineBefore( pxTasks, xTaskCount, ulBusyPeriod );
+
+        while( ulInterval != 0U )
+        {
+            ullDemand = ullEDFAnalysisDemand( pxTasks, xTaskCount, ulInterval );
+
+            if( ullDemand > ( uint64_t ) ulInterval )
+            {
+                eResult = eEDFDeadlineMiss;
+                break;
+            }
+            else if( ullDemand <= ( uint64_t ) ulMinDeadline )
+            {
+                break;
+            }
+            else if( ullDemand < ( uint64_t ) ulInterval )
+            {
+                ulInterval = ( uint32_t ) ullDemand;
+            }
+            else
+            {
+                ulInterval = prvLastDeadlineBefore( pxTasks, xTaskCount, ulInterval );
+            }
+        }
+    }
+
+    if( pulFailingInterval != NULL )
+    {
+        *pulFailingInterval = ( eResult == eEDFDeadlineMiss ) ? ulInterval : 0U;
+    }
+
+    return eResult;
+}
+/*-----------------------------------------------------------*/
+
+static eEDFAnalysisResult prvCheckUtilization( const EDFAnalysisTask_t * pxTasks,
+                                               size_t xTaskCount )
+{
+    uint64_t ullUtilization = 0U;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        /* Stop before the sum can overflow. */
+        ullUtilization += prvUtilization( &( pxTasks[ x ] ) );
+
+        if( ullUtilization > edfUTILIZATION_ONE )
+        {
+            return eEDFOverloaded;
+        }
+    }
+
+    return eEDFSchedulable;
+}
+/*-----------------------------------------------------------*/
+
+static eEDFAnalysisResult prvIntervalBound( const EDFAnalysisTask_t * pxTasks,
+                                            size_t xTaskCount,
+                                            uint32_t * pulLength )
+{
+    uint64_t ullUtilization = 0U, ullSlack = 0U, ullSum = 0U, ullBound = 0U, ullLimit = edfMAX_INTERVAL;
+    uint32_t ulMaxDeadline = 0U;
+    int iConstrained = 0;
+    size_t x;
+
+    /* Everything is rounded so that L_a comes out too long rather than too
+     * short: the utilization up, and each term of the sum up. */
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        ullUtilization += prvUtilizationCeiling( &( pxTasks[ x ] ) );
+
+        if( pxTasks[ x ].ulDeadline > ulMaxDeadline )
+        {
+            ulMaxDeadline = pxTasks[ x ].ulDeadline;
+        }
+
+        if( pxTasks[ x ].ulDeadline < pxTasks[ x ].ulPeriod )
+        {
+            iConstrained = 1;
+            ullSum += ( ( ( uint64_t ) ( pxTasks[ x ].ulPeriod - pxTasks[ x ].ulDeadline ) * pxTasks[ x ].ulWCET ) + pxTasks[ x ].ulPeriod - 1U ) / pxTasks[ x ].ulPeriod;
+        }
+    }
+
+    if( ullUtilization < edfUTILIZATION_ONE )
+    {
+        ullSlack = edfUTILIZATION_ONE - ullUtilization;
+    }
+
+    if( ( iConstrained == 0 ) && ( ullUtilization <= edfUTILIZATION_ONE ) )
+    {
+        /* No deadline before its period and a utilization of at most 1, so
+         * the tasks are schedulable with no interval to check. */
+        *pulLength = 0U;
+
+        return eEDFSchedulable;
+    }
+
+    /* L_a fits in edfMAX_INTERVAL only if the sum is below the slack, which
+     * also keeps the shift from overflowing. */
+    if( ullSum < ullSlack )
+    {
+        ullBound = ( ( ullSum << 32 ) + ullSlack - 1U ) / ullSlack;
+
+        if( ullBound < ( uint64_t ) ulMaxDeadline )
+        {
+            ullBound = ulMaxDeadline;
+        }
+
+        /* Deadlines at L_a itself must be checked too. */
+        ullBound++;
+
+        if( ullBound <= edfMAX_INTERVAL )
+        {
+            ullLimit = ullBound;
+        }
+        else
+        {
+            ullBound = 0U;
+        }
+    }
+
+    if( prvBusyPeriod( pxTasks, xTaskCount, ullLimit, pulLength ) == eEDFSchedulable )
+    {
+        return eEDFSchedulable;
+    }
+    else if( ullBound != 0U )
+    {
+        *pulLength = ( uint32_t ) ullBound;
+
+        return eEDFSchedulable;
+    }
+    else
+    {
+        return eEDFNotProven;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static eEDFAnalysisResult prvBusyPeriod( const EDFAnalysisTask_t * pxTasks,
+                                         size_t xTaskCount,
+                                         uint64_t ullLimit,
+                                         uint32_t * pulLength )
+{
+    uint64_t ullLength = 0U, ullNext;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        ullLength += pxTasks[ x ].ulWCET;
+    }
+
+    /* w( n + 1 ) = sum of ceil( w( n ) / T ) * C, until it stops growing. */
+    for( ; ; )
+    {
+        if( ullLength > ullLimit )
+        {
+            return eEDFNotProven;
+        }
+
+        ullNext = 0U;
+
+        for( x = 0; x < xTaskCount; x++ )
+        {
+            ullNext += ( ( ullLength + pxTasks[ x ].ulPeriod - 1U ) / pxTasks[ x ].ulPeriod ) * pxTasks[ x ].ulWCET;
+        }
+
+        if( ullNext == ullLength )
+        {
+            break;
+        }
+
+        ullLength = ullNext;
+    }
+
+    *pulLength = ( uint32_t ) ullLength;
+
+    return eEDFSchedulable;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvLastDeadlineBefore( const EDFAnalysisTask_t * pxTasks,
+                                       size_t xTaskCount,
+                                       uint32_t ulInterval )
+{
+    uint32_t ulLast = 0U, ulDeadline;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        if( pxTasks[ x ].ulDeadline < ulInterval )
+        {
+            ulDeadline = pxTasks[ x ].ulDeadline + ( ( ( ulInterval - 1U - pxTasks[ x ].ulDeadline ) / pxTasks[ x ].ulPeriod ) * pxTasks[ x ].ulPeriod );
+
+            if( ulDeadline > ulLast )
+            {
+                ulLast = ulDeadline;
+            }
+        }
+    }
+
+    return ulLast;
+}
+/*-----------------------------------------------------------*/
+
+eEDFAnalysisResult eEDFAnalysisPartition( const EDFAnalysisTask_t * pxTasks,
+                                          size_t xTaskCount,
+                                          size_t xCoreCount,
+                                          EDFAnalysisTask_t * pxWorkspace,
+                                          size_t * pxCoreOfTask )
+{
+    eEDFAnalysisResult eResult = eEDFSchedulable;
+    uint64_t ullLargest, ullLoad, ullTriedLoad, ullBestLoad;
+    size_t x, xPlaced, xTask, xCore, xTriedCore, xBestCore;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        pxCoreOfTask[ x ] = edfANALYSIS_NO_CORE;
+
+        if( ( pxTasks[ x ].ulPeriod == 0U ) || ( pxTasks[ x ].ulDeadline == 0U ) )
+        {
+            eResult = eEDFInvalidTaskSet;
+        }
+    }
+
+    if( xCoreCount == 0U )
+    {
+        eResult = eEDFInvalidTaskSet;
+    }
+
+    for( xPlaced = 0; ( xPlaced < xTaskCount ) && ( eResult == eEDFSchedulable ); xPlaced++ )
+    {
+        /* The unplaced task of highest utilization, the first one on a tie. */
+        xTask = edfANALYSIS_NO_CORE;
+        ullLargest = 0U;
+
+        for( x = 0; x < xTaskCount; x++ )
+        {
+            if( ( pxCoreOfTask[ x ] == edfANALYSIS_NO_CORE ) &&
+                ( ( xTask == edfANALYSIS_NO_CORE ) || ( prvUtilization( &( pxTasks[ x ] ) ) > ullLargest ) ) )
+            {
+                xTask = x;
+                ullLargest = prvUtilization( &( pxTasks[ x ] ) );
+            }
+        }
+
+        /* Try the cores from the least loaded up.  The loads are recomputed
+         * rather than stored, so no storage is needed per core - each step
+         * looks for the lowest ( load, core ) pair above the one last tried. */
+        ullTriedLoad = 0U;
+        xTriedCore = edfANALYSIS_NO_CORE;
+
+        for( ; ; )
+        {
+            xBestCore = edfANALYSIS_NO_CORE;
+            ullBestLoad = 0U;
+
+            for( xCore = 0; xCore < xCoreCount; xCore++ )
+            {
+                ullLoad = prvCoreUtilization( pxTasks, xTaskCount, pxCoreOfTask, xCore );
+
+                if( ( xTriedCore != edfANALYSIS_NO_CORE ) &&
+                    ( ( ullLoad < ullTriedLoad ) || ( ( ullLoad == ullTriedLoad ) && ( xCore <= xTriedCore ) ) ) )
+                {
+                    /* Already tried. */
+                }
+                else if( ( xBestCore == edfANALYSIS_NO_CORE ) || ( ullLoad < ullBestLoad ) )
+                {
+                    xBestCore = xCore;
+                    ullBestLoad = ullLoad;
+                }
+            }
+
+            if( xBestCore == edfANALYSIS_NO_CORE )
+            {
+                eResult = eEDFNotPartitioned;
+                break;
+            }
+
+            if( prvCoreQPA( pxTasks, xTaskCount, pxCoreOfTask, xBestCore, xTask, pxWorkspace ) == eEDFSchedulable )
+            {
+                pxCoreOfTask[ xTask ] = xBestCore;
+                break;
+            }
+
+            ullTriedLoad = ullBestLoad;
+            xTriedCore = xBestCore;
+        }
+    }
+
+    return eResult;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvUtilization( const EDFAnalysisTask_t * pxTask )
+{
+    return ( ( uint64_t ) pxTask->ulWCET << 32 ) / pxTask->ulPeriod;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvUtilizationCeiling( const EDFAnalysisTask_t * pxTask )
+{
+    /* At most ( 2^32 - 1 ) * 2^32 + 2^32 - 1, so the sum does not overflow. */
+    return ( ( ( uint64_t ) pxTask->ulWCET << 32 ) + pxTask->ulPeriod - 1U ) / pxTask->ulPeriod;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvCoreUtilization( const EDFAnalysisTask_t * pxTasks,
+                                    size_t xTaskCount,
+                                    const size_t * pxCoreOfTask,
+                                    size_t xCore )
+{
+    uint64_t ullUtilization = 0U;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        if( pxCoreOfTask[ x ] == xCore )
+        {
+            ullUtilization += prvUtilization( &( pxTasks[ x ] ) );
+        }
+    }
+
+    return ullUtilization;
+}
+/*-----------------------------------------------------------*/
+
+static eEDFAnalysisResult prvCoreQPA( const EDFAnalysisTask_t * pxTasks,
+                                      size_t xTaskCount,
+                                      const size_t * pxCoreOfTask,
+                                      size_t xCore,
+                                      size_t xCandidate,
+                                      EDFAnalysisTask_t * pxWorkspace )
+{
+    size_t x, xCount = 0U;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        if( ( pxCoreOfTask[ x ] == xCore ) || ( x == xCandidate ) )
+        {
+            pxWorkspace[ xCount ] = pxTasks[ x ];
+            xCount++;
+        }
+    }
+
+    return eEDFAnalysisQPA( pxWorkspace, xCount, NULL );
+}
+/*-----------------------------------------------------------*/
+
+eEDFAnalysisResult eEDFAnalysisGlobalGFB( const EDFAnalysisTask_t * pxTasks,
+                                          size_t xTaskCount,
+                                          size_t xCoreCount )
+{
+    eEDFAnalysisResult eResult = eEDFSchedulable;
+    uint64_t ullUtilization = 0U, ullDensity = 0U, ullLargest = 0U, ullTaskDensity;
+    uint32_t ulWindow;
+    size_t x;
+
+    if( xCoreCount == 0U )
+    {
+        eResult = eEDFInvalidTaskSet;
+    }
+
+    for( x = 0; ( x < xTaskCount ) && ( eResult == eEDFSchedulable ); x++ )
+    {
+        if( ( pxTasks[ x ].ulPeriod == 0U ) || ( pxTasks[ x ].ulDeadline == 0U ) )
+        {
+            eResult = eEDFInvalidTaskSet;
+        }
+        else
+        {
+            ulWindow = ( pxTasks[ x ].ulDeadline < pxTasks[ x ].ulPeriod ) ? pxTasks[ x ].ulDeadline : pxTasks[ x ].ulPeriod;
+            ullTaskDensity = ( ( uint64_t ) pxTasks[ x ].ulWCET << 32 ) / ulWindow;
+
+            if( ullTaskDensity > edfUTILIZATION_ONE )
+            {
+                eResult = eEDFDeadlineMiss;
+            }
+
+            /* Each term is at most 1 here, so the sums cannot overflow for any
+             * realistic number of tasks. */
+            ullUtilization += prvUtilization( &( pxTasks[ x ] ) );
+            ullDensity += ullTaskDensity;
+
+            if( ullTaskDensity > ullLargest )
+            {
+                ullLargest = ullTaskDensity;
+            }
+        }
+    }
+
+    if( eResult == eEDFSchedulable )
+    {
+        if( ullUtilization > ( ( uint64_t ) xCoreCount * edfUTILIZATION_ONE ) )
+        {
+            eResult = eEDFOverloaded;
+        }
+        else if( ullDensity > ( ( ( uint64_t ) xCoreCount * edfUTILIZATION_ONE ) - ( ( uint64_t ) ( xCoreCount - 1U ) * ullLargest ) ) )
+        {
+            eResult = eEDFNotProven;
+        }
+    }
+
+    return eResult;
+}
+/*-----------------------------------------------------------*/
+
+eEDFAnalysisResult eEDFAnalysisSplitCD( const EDFAnalysisTask_t * pxTasks,
+                                        size_t xTaskCount,
+                                        size_t xCoreCount,
+                                        EDFAnalysisTask_t * pxWorkspace,
+                                        EDFAnalysisSplit_t * pxAssignment )
+{
+    eEDFAnalysisResult eResult = eEDFSchedulable;
+    EDFAnalysisTask_t xPart;
+    uint64_t ullLargest;
+    uint32_t ulLow, ulHigh, ulMiddle;
+    size_t x, xPlaced, xTask, xCore, xSecondCore;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        pxAssignment[ x ].xFirstCore = edfANALYSIS_NO_CORE;
+        pxAssignment[ x ].xSecondCore = edfANALYSIS_NO_CORE;
+        pxAssignment[ x ].ulFirstWCET = pxTasks[ x ].ulWCET;
+        pxAssignment[ x ].ulSecondDeadline = pxTasks[ x ].ulDeadline;
+
+        if( ( pxTasks[ x ].ulPeriod == 0U ) || ( pxTasks[ x ].ulDeadline == 0U ) )
+        {
+            eResult = eEDFInvalidTaskSet;
+        }
+    }
+
+    if( xCoreCount == 0U )
+    {
+        eResult = eEDFInvalidTaskSet;
+    }
+
+    for( xPlaced = 0; ( xPlaced < xTaskCount ) && ( eResult == eEDFSchedulable ); xPlaced++ )
+    {
+        /* The unplaced task of highest utilization, the first one on a tie. */
+        xTask = edfANALYSIS_NO_CORE;
+        ullLargest = 0U;
+
+        for( x = 0; x < xTaskCount; x++ )
+        {
+            if( ( pxAssignment[ x ].xFirstCore == edfANALYSIS_NO_CORE ) &&
+                ( ( xTask == edfANALYSIS_NO_CORE ) || ( prvUtilization( &( pxTasks[ x ] ) ) > ullLargest ) ) )
+            {
+                xTask = x;
+                ullLargest = prvUtilization( &( pxTasks[ x ] ) );
+            }
+        }
+
+        /* First fit for the whole task. */
+        for( xCore = 0; xCore < xCoreCount; xCore++ )
+        {
+            if( prvSplitCoreQPA( pxTasks, xTaskCount, pxAssignment, xCore, &( pxTasks[ xTask ] ), pxWorkspace ) == eEDFSchedulable )
+            {
+                pxAssignment[ xTask ].xFirstCore = xCore;
+                break;
+            }
+        }
+
+        /* Otherwise split it over the first pair of cores that can take it. */
+        for( xCore = 0; ( xCore < xCoreCount ) && ( pxAssignment[ xTask ].xFirstCore == edfANALYSIS_NO_CORE ); xCore++ )
+        {
+            /* The largest first part that fits, found by bisection: ulLow
+             * always fits, ulHigh is never taken.  The first part ends at its
+             * own deadline, so it must end before the deadline of the job. */
+            xPart.ulPeriod = pxTasks[ xTask ].ulPeriod;
+            ulLow = 0U;
+            ulHigh = ( pxTasks[ xTask ].ulWCET < pxTasks[ xTask ].ulDeadline ) ? pxTasks[ xTask ].ulWCET : pxTasks[ xTask ].ulDeadline;
+
+            while( ( ulHigh - ulLow ) > 1U )
+            {
+                ulMiddle = ulLow + ( ( ulHigh - ulLow ) / 2U );
+                xPart.ulWCET = ulMiddle;
+                xPart.ulDeadline = ulMiddle;
+
+                if( prvSplitCoreQPA( pxTasks, xTaskCount, pxAssignment, xCore, &xPart, pxWorkspace ) == eEDFSchedulable )
+                {
+                    ulLow = ulMiddle;
+                }
+                else
+                {
+                    ulHigh = ulMiddle;
+                }
+            }
+
+            /* Unless nothing of the task fits on this core, place the rest,
+             * which cannot run longer than the time left to the deadline. */
+            if( ( ulLow > 0U ) &&
+                ( ( pxTasks[ xTask ].ulWCET - ulLow ) <= ( pxTasks[ xTask ].ulDeadline - ulLow ) ) )
+            {
+                xPart.ulWCET = pxTasks[ xTask ].ulWCET - ulLow;
+                xPart.ulDeadline = pxTasks[ xTask ].ulDeadline - ulLow;
+
+                for( xSecondCore = 0; xSecondCore < xCoreCount; xSecondCore++ )
+                {
+                    if( ( xSecondCore != xCore ) &&
+                        ( prvSplitCoreQPA( pxTasks, xTaskCount, pxAssignment, xSecondCore, &xPart, pxWorkspace ) == eEDFSchedulable ) )
+                    {
+                        pxAssignment[ xTask ].xFirstCore = xCore;
+                        pxAssignment[ xTask ].xSecondCore = xSecondCore;
+                        pxAssignment[ xTask ].ulFirstWCET = ulLow;
+                        pxAssignment[ xTask ].ulSecondDeadline = xPart.ulDeadline;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if( pxAssignment[ xTask ].xFirstCore == edfANALYSIS_NO_CORE )
+        {
+            eResult = eEDFNotPartitioned;
+        }
+    }
+
+    return eResult;
+}
+/*-----------------------------------------------------------*/
+
+static eEDFAnalysisResult prvSplitCoreQPA( const EDFAnalysisTask_t * pxTasks,
+                                           size_t xTaskCount,
+                                           const EDFAnalysisSplit_t * pxAssignment,
+                                           size_t xCore,
+                                           const EDFAnalysisTask_t * pxCandidate,
+                                           EDFAnalysisTask_t * pxWorkspace )
+{
+    size_t x, xCount = 0U;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        if( pxAssignment[ x ].xFirstCore == xCore )
+        {
+            /* A whole task, or the first part of one, with C = D. */
+            pxWorkspace[ xCount ].ulPeriod = pxTasks[ x ].ulPeriod;
+            pxWorkspace[ xCount ].ulWCET = pxAssignment[ x ].ulFirstWCET;
+            pxWorkspace[ xCount ].ulDeadline = ( pxAssignment[ x ].xSecondCore == edfANALYSIS_NO_CORE ) ? pxTasks[ x ].ulDeadline : pxAssignment[ x ].ulFirstWCET;
+            xCount++;
+        }
+        else if( pxAssignment[ x ].xSecondCore == xCore )
+        {
+            pxWorkspace[ xCount ].ulPeriod = pxTasks[ x ].ulPeriod;
+            pxWorkspace[ xCount ].ulWCET = pxTasks[ x ].ulWCET - pxAssignment[ x ].ulFirstWCET;
+            pxWorkspace[ xCount ].ulDeadline = pxAssignment[ x ].ulSecondDeadline;
+            xCount++;
+        }
+    }
+
+    /* The candidate is not in the assignment yet, and the workspace has room
+     * for it as its task was not counted above. */
+    if( pxCandidate != NULL )
+    {
+        pxWorkspace[ xCount ] = *pxCandidate;
+        xCount++;
+    }
+
+    return eEDFAnalysisQPA( pxWorkspace, xCount, NULL );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,223 @@
+/*
+ * EDF schedulability analysis for sets of periodic tasks.
+ *
+ * Plain C with no dependency on the kernel, so the same code can gate task
+ * creation on the target and validate task set configurations on a host.
+ * All times are in ticks.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef EDF_ANALYSIS_H
+#define EDF_ANALYSIS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* One periodic task, as seen by the analysis. */
+typedef struct xEDF_ANALYSIS_TASK
+{
+    uint32_t ulPeriod;   /*< Time between two releases.  Must not be zero. */
+    uint32_t ulDeadline; /*< Deadline relative to each release.  Must not be zero. */
+    uint32_t ulWCET;     /*< Worst case execution time of one job. */
+} EDFAnalysisTask_t;
+
+/* Outcome of an analysis. */
+typedef enum
+{
+    eEDFSchedulable = 0, /* Every deadline is met when all tasks are released together. */
+    eEDFDeadlineMiss,    /* The processor demand exceeds the length of some interval. */
+    eEDFOverloaded,      /* The utilization is above 1, so the demand grows without bound. */
+    eEDFInvalidTaskSet,  /* A task has a zero period or deadline. */
+    eEDFNotPartitioned,  /* No core of a partition can take one of the tasks. */
+    eEDFNotProven        /* A sufficient test could not show the task set schedulable. */
+} eEDFAnalysisResult;
+
+/* The core of a task that could not be placed on any core. */
+#define edfANALYSIS_NO_CORE    ( ( size_t ) -1 )
+
+/* Where eEDFAnalysisSplitCD() puts one task.  A task that is not split runs on
+ * xFirstCore alone with its own WCET and deadline.  A split task runs the first
+ * ulFirstWCET ticks of each job on xFirstCore, with that as the relative
+ * deadline too, and then migrates to xSecondCore to run the rest with the
+ * relative deadline ulSecondDeadline, which ends at the deadline of the job. */
+typedef struct xEDF_ANALYSIS_SPLIT
+{
+    size_t xFirstCore;         /*< Core of the task, or of the first part of a split task. */
+    size_t xSecondCore;        /*< Core of the second part, or edfANALYSIS_NO_CORE if the task is not split. */
+    uint32_t ulFirstWCET;      /*< Budget, and relative deadline, of the first part of a split task. */
+    uint32_t ulSecondDeadline; /*< Relative deadline of the second part, counted from the release of the job. */
+} EDFAnalysisSplit_t;
+
+/**
+ * edf_analysis.h
+ * <pre>
+ * eEDFAnalysisResult eEDFAnalysisQPA( const EDFAnalysisTask_t * pxTasks,
+ *                                     size_t xTaskCount,
+ *                                     uint32_t * pulFailingInterval );
+ * </pre>
+ *
+ * Exact EDF test for a task set with arbitrary deadlines, using Quick
+ * Processor-demand Analysis (Zhang and Burns).  The processor demand h(t) is
+ * checked against t backwards from the end of the synchronous busy period, or
+ * from the bound L_a when that is shorter, jumping straight to h(t) whenever
+ * h(t) < t, so only a small number of the absolute deadlines in the interval
+ * are visited.  A task set with no deadline shorter than its period is decided
+ * on its utilization alone.
+ *
+ * @param pxTasks The task set.  It is not modified.
+ *
+ * @param xTaskCount The number of entries in pxTasks.
+ *
+ * @param pulFailingInterval Optional.  When eEDFDeadlineMiss is returned it is
+ * set to the length t of the interval [0, t) in which the demand h(t) was found
+ * to exceed t, otherwise it is set to zero.
+ *
+ * @return The outcome of the test.  eEDFNotProven is returned for a task set
+ * with a utilization of 1, or within 2^-32 per task of it, whose interval to
+ * check does not fit in 32 bits.
+ */
+eEDFAnalysisResult eEDFAnalysisQPA( const EDFAnalysisTask_t * pxTasks,
+                                    size_t xTaskCount,
+                                    uint32_t * pulFailingInterval );
+
+/**
+ * edf_analysis.h
+ * <pre>
+ * uint64_t ullEDFAnalysisDemand( const EDFAnalysisTask_t * pxTasks,
+ *                                size_t xTaskCount,
+ *                                uint32_t ulInterval );
+ * </pre>
+ *
+ * @return The processor demand h(t) of the task set for t = ulInterval, that is
+ * the execution time of all the jobs released at or after 0 with a deadline at
+ * or before ulInterval.
+ */
+uint64_t ullEDFAnalysisDemand( const EDFAnalysisTask_t * pxTasks,
+                               size_t xTaskCount,
+                               uint32_t ulInterval );
+
+/**
+ * edf_analysis.h
+ * <pre>
+ * eEDFAnalysisResult eEDFAnalysisPartition( const EDFAnalysisTask_t * pxTasks,
+ *                                           size_t xTaskCount,
+ *                                           size_t xCoreCount,
+ *                                           EDFAnalysisTask_t * pxWorkspace,
+ *                                           size_t * pxCoreOfTask );
+ * </pre>
+ *
+ * Partition a task set over xCoreCount cores, each running its own EDF
+ * scheduler, with worst-fit decreasing bin-packing.  The tasks are placed in
+ * order of decreasing utilization, each on the least loaded core that QPA
+ * still finds schedulable with it, so the load is spread evenly and every core
+ * keeps room for the smaller tasks placed last.  Meant to run offline or once
+ * at boot: it takes O(n^2 * m) steps plus one QPA per attempted placement.
+ *
+ * @param pxTasks The task set.  It is not modified.
+ *
+ * @param xTaskCount The number of entries in pxTasks.
+ *
+ * @param xCoreCount The number of cores.  Must not be zero.
+ *
+ * @param pxWorkspace Room for xTaskCount tasks, used to build the task set of
+ * one core for QPA.
+ *
+ * @param pxCoreOfTask Receives xTaskCount core numbers, from 0 to
+ * xCoreCount - 1, in the order of pxTasks.  A task that fits on no core is
+ * left at edfANALYSIS_NO_CORE, as are the tasks not yet placed then.
+ *
+ * @return eEDFSchedulable if every task was placed, eEDFNotPartitioned if a task
+ * did not fit, or eEDFInvalidTaskSet.
+ */
+eEDFAnalysisResult eEDFAnalysisPartition( const EDFAnalysisTask_t * pxTasks,
+                                          size_t xTaskCount,
+                                          size_t xCoreCount,
+                                          EDFAnalysisTask_t * pxWorkspace,
+                                          size_t * pxCoreOfTask );
+
+/**
+ * edf_analysis.h
+ * <pre>
+ * eEDFAnalysisResult eEDFAnalysisGlobalGFB( const EDFAnalysisTask_t * pxTasks,
+ *                                           size_t xTaskCount,
+ *                                           size_t xCoreCount );
+ * </pre>
+ *
+ * Sufficient test for global EDF, where the xCoreCount earliest deadline jobs
+ * run on xCoreCount cores and jobs migrate freely.  With the density of a task
+ * taken as its WCET over the shorter of its deadline and period, the task set is
+ * schedulable if the total density is at most m - ( m - 1 ) * the largest one
+ * (Goossens, Funk and Baruah, extended to constrained deadlines by Bertogna).
+ * O(n).  A single task of high density lowers the bound the most, which is why
+ * global EDF suits sets of many light tasks better than partitioning does.
+ *
+ * @param pxTasks The task set.  It is not modified.
+ *
+ * @param xTaskCount The number of entries in pxTasks.
+ *
+ * @param xCoreCount The number of cores.  Must not be zero.
+ *
+ * @return eEDFSchedulable if the bound holds, eEDFOverloaded if the total
+ * utilization is above xCoreCount, eEDFDeadlineMiss if a job cannot meet its
+ * deadline even alone, eEDFNotProven otherwise, or eEDFInvalidTaskSet.
+ */
+eEDFAnalysisResult eEDFAnalysisGlobalGFB( const EDFAnalysisTask_t * pxTasks,
+                                          size_t xTaskCount,
+                                          size_t xCoreCount );
+
+/**
+ * edf_analysis.h
+ * <pre>
+ * eEDFAnalysisResult eEDFAnalysisSplitCD( const EDFAnalysisTask_t * pxTasks,
+ *                                         size_t xTaskCount,
+ *                                         size_t xCoreCount,
+ *                                         EDFAnalysisTask_t * pxWorkspace,
+ *                                         EDFAnalysisSplit_t * pxAssignment );
+ * </pre>
+ *
+ * Semi-partitioned assignment with C=D task splitting (Burns, Davis, Wang and
+ * Zhang).  The tasks are placed in order of decreasing utilization, each on
+ * the first core that QPA still finds schedulable with it, so the cores are
+ * filled one after the other.  A task that fits on no core whole is split in
+ * two: the largest first part that still fits on a core is given a deadline
+ * equal to its WCET, so it runs as soon as the job is released, and the rest is
+ * placed on another core with the time left to the deadline.  This takes up the
+ * capacity that plain partitioning leaves stranded on each core.  Meant to run
+ * offline or once at boot.
+ *
+ * @param pxTasks The task set.  It is not modified.
+ *
+ * @param xTaskCount The number of entries in pxTasks.
+ *
+ * @param xCoreCount The number of cores.  Must not be zero.
+ *
+ * @param pxWorkspace Room for xTaskCount tasks, used to build the task set of
+ * one core for QPA.
+ *
+ * @param pxAssignment Receives xTaskCount placements, in the order of pxTasks.
+ * A task that could not be placed, or was not reached, has xFirstCore set to
+ * edfANALYSIS_NO_CORE.
+ *
+ * @return eEDFSchedulable if every task was placed, eEDFNotPartitioned if a task
+ * fitted on no pair of cores, or eEDFInvalidTaskSet.
+ */
+eEDFAnalysisResult eEDFAnalysisSplitCD( const EDFAnalysisTask_t * pxTasks,
+                                        size_t xTaskCount,
+                                        size_t xCoreCount,
+                                        EDFAnalysisTask_t * pxWorkspace,
+                                        EDFAnalysisSplit_t * pxAssignment );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* EDF_ANALYSIS_H */
@@ -0,0 +1,32 @@
+/*
+ * Binary trace of scheduler events in a fixed-size ring.
+ * See edf_trace.h for the description of the API.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include "edf_trace.h"
+
+EDFTraceRing_t xEDFTraceRing = { edfTRACE_MAGIC, edfTRACE_RING_LENGTH, 0U, { { 0U, 0U, 0U, 0U, 0U } } };
+/*-----------------------------------------------------------*/
+
+void vEDFTraceWrite( uint8_t ucEvent,
+                     uint32_t ulTimestamp,
+                     uint32_t ulTaskNumber,
+                     uint32_t ulDeadline )
+{
+    const uint32_t ulHead = xEDFTraceRing.ulHead;
+    EDFTraceRecord_t * const pxRecord = &( xEDFTraceRing.xRecords[ ulHead & ( edfTRACE_RING_LENGTH - 1U ) ] );
+
+    pxRecord->ulTimestamp = ulTimestamp;
+    pxRecord->ucEvent = ucEvent;
+    pxRecord->ucReserved = 0U;
+    pxRecord->usTaskNumber = ( uint16_t ) ulTaskNumber;
+    pxRecord->ulDeadline = ulDeadline;
+
+    /* Publish the record only once it is complete.  Only ulHead is volatile,
+     * so the stores above must not be moved after this one. */
+    edfTRACE_MEMORY_BARRIER();
+    xEDFTraceRing.ulHead = ulHead + 1U;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,102 @@
+/*
+ * Binary trace of scheduler events in a fixed-size ring.
+ *
+ * Each event is one fixed-size record, written in a few stores with no lock,
+ * no branch on the task and no division, so it can be called from the context
+ * switch of every task.  The ring is a single structure in RAM that a debugger
+ * can dump as it is, to be turned into timelines on a host by
+ * tools/edf_trace_decode.c.
+ *
+ * Plain C with no dependency on the kernel, like edf_analysis.h, so the same
+ * header describes the records on the target and on the host.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef EDF_TRACE_H
+#define EDF_TRACE_H
+
+#include <stdint.h>
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Number of records in the ring.  Must be a power of two, so the write cursor
+ * can run freely and be masked into an index. */
+#ifndef edfTRACE_RING_LENGTH
+    #define edfTRACE_RING_LENGTH    256U
+#endif
+
+#if ( ( edfTRACE_RING_LENGTH & ( edfTRACE_RING_LENGTH - 1U ) ) != 0U )
+    #error edfTRACE_RING_LENGTH must be a power of two
+#endif
+
+/* Keeps the compiler from moving the stores of a record after the store of
+ * ulHead that publishes it.  The default is for GCC and compatible compilers,
+ * other compilers must define their own. */
+#ifndef edfTRACE_MEMORY_BARRIER
+    #define edfTRACE_MEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
+#endif
+
+/* Marks a valid ring in a memory dump, "EDFT" when read as bytes. */
+#define edfTRACE_MAGIC    ( ( uint32_t ) 0x54464445UL )
+
+/* Event types. */
+#define edfTRACE_SWITCHED_IN     ( ( uint8_t ) 1U ) /* The task starts running. */
+#define edfTRACE_SWITCHED_OUT    ( ( uint8_t ) 2U ) /* The task stops running, for any reason. */
+#define edfTRACE_PREEMPTED       ( ( uint8_t ) 3U ) /* Follows edfTRACE_SWITCHED_OUT when the task was still ready. */
+
+/* One event.  12 bytes, with no padding on the target or the host. */
+typedef struct xEDF_TRACE_RECORD
+{
+    uint32_t ulTimestamp;  /*< Time of the event, in the units of the timestamp source. */
+    uint8_t ucEvent;       /*< One of the edfTRACE_ event types. */
+    uint8_t ucReserved;    /*< Zero. */
+    uint16_t usTaskNumber; /*< uxTCBNumber of the task, as set with configUSE_TRACE_FACILITY. */
+    uint32_t ulDeadline;   /*< Absolute deadline of the task, in ticks. */
+} EDFTraceRecord_t;
+
+/* The ring.  ulHead counts every record ever written, so the newest record is
+ * at ( ulHead - 1 ) modulo ulLength, and only the last ulLength records are
+ * kept.  ulHead is incremented after the record is complete, so a reader that
+ * sees it move past a slot knows the slot is fully written. */
+typedef struct xEDF_TRACE_RING
+{
+    uint32_t ulMagic;                               /*< edfTRACE_MAGIC. */
+    uint32_t ulLength;                              /*< edfTRACE_RING_LENGTH. */
+    volatile uint32_t ulHead;                       /*< Number of records written so far. */
+    EDFTraceRecord_t xRecords[ edfTRACE_RING_LENGTH ]; /*< The records. */
+} EDFTraceRing_t;
+
+/* The ring of the application, to be dumped by a debugger. */
+extern EDFTraceRing_t xEDFTraceRing;
+
+/**
+ * edf_trace.h
+ * <pre>
+ * void vEDFTraceWrite( uint8_t ucEvent,
+ *                      uint32_t ulTimestamp,
+ *                      uint32_t ulTaskNumber,
+ *                      uint32_t ulDeadline );
+ * </pre>
+ *
+ * Append one record to xEDFTraceRing, overwriting the oldest once the ring is
+ * full.  O(1).  There is a single write cursor and no lock, so records must only
+ * be written from one context at a time - the trace macros of the context
+ * switch, which runs with interrupts masked, are the intended callers.
+ */
+void vEDFTraceWrite( uint8_t ucEvent,
+                     uint32_t ulTimestamp,
+                     uint32_t ulTaskNumber,
+                     uint32_t ulDeadline );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* EDF_TRACE_H */
@@ -59,6 +59,7 @@
 /* Scheduler includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "task_edf.h"
 #include "lpc21xx.h"
 #include "queue.h"
 
@@ -75,6 +76,9 @@
 /* Constants for the ComTest demo application tasks. */
 #define mainCOM_TEST_BAUD_RATE	( ( unsigned long ) 115200 )
 
+/* Stack of each task, in words.  100 on the target, more in the Linux simulator where it is also the stack of a pthread. */
+#define mainTASK_STACK_SIZE		( configMINIMAL_STACK_SIZE + 10 )
+
 /*****************************************Defintions used in the main **************************/
 
 #define NULL_PTR 	(void *) 0
@@ -89,10 +93,16 @@
 /************** Periodicity of the Tasks************************/
 #define BUTTON1_TASK_PERIOD				50
 #define BUTTON2_TASK_PERIOD				50
+#define BUTTON_TASK_WCET				1
 #define PERIODIC_TASK_PERIOD			100
-#define UART_TASK_PERIOD				20
+#define PERIODIC_TASK_DEADLINE			20
+#define PERIODIC_TASK_WCET				1
+#define UART_SERVER_BUDGET				2
+#define UART_SERVER_PERIOD				10
 #define LOAD1_TASK_PERIOD				10
+#define LOAD1_TASK_WCET					5
 #define LOAD2_TASK_PERIOD				100
+#define LOAD2_TASK_WCET					13
 
 /********************************************************************
 **********************Task Handlers***********************************
@@ -104,24 +114,20 @@ TaskHandle_t Button_2_MonitorHandler = NULL;
 TaskHandle_t Periodic_TransmitterHandler = NULL;
 TaskHandle_t Uart_ReceiverHandler = NULL;
 
+/******************************Server Handler **************************/
+ServerHandle_t Uart_ServerHandler = NULL;
+
 TaskHandle_t Load1Handler = NULL;
 TaskHandle_t Load2Handler = NULL;
 
 /******************************Queue Handler **************************/
 QueueHandle_t xMessageBuffer = NULL;
 
+/******************************Resource Handlers **************************/
+ResourceHandle_t Load_LogResource = NULL;	/* protects Load_Jobs, used by both loads */
+ResourceHandle_t Led_Resource = NULL;		/* protects PORT_1 PIN1, used by button 1 and load 2 */
 
-
-/* Variables for Calculating the times and CPU Load*/
-int button1_in_time, button1_out_time,button1_total_time = 0;
-int button2_in_time, button2_out_time,button2_total_time = 0;
-int periodic_transmitter_in_time, periodic_transmitter_out_time,periodic_transmitter_total_time = 0;
-int receiver_in_time, receiver_out_time,receiver_total_time = 0;
-int load1_in_time, load1_out_time,load1_total_time = 0;
-int load2_in_time, load2_out_time,load2_total_time = 0;
-
-int system_time = 0;
-int cpu_load = 0;
+unsigned long Load_Jobs[2] = {0, 0};		/* jobs completed by load 1 and load 2 */
 
 
 
@@ -141,10 +147,9 @@ static void prvSetupHardware( void );
 
 void Button_1_Monitor(void * pvParameters)
 {
-	int xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetTickCount();
 	pinState_t previous_state = PIN_IS_LOW , current_state = PIN_IS_LOW;  /* States for the Button input*/
 	char* button1_message = NULL_PTR;	/* pointer to char holds the sent message */
-	vTaskSetApplicationTaskTag(NULL,(void *) 2); /*giving Tag to the task to use Trace Hooks */
 	
 	for(;;)
 	{
@@ -162,6 +167,10 @@ void Button_1_Monitor(void * pvParameters)
 				xQueueSend(xMessageBuffer, (void *) &button1_message, ( TickType_t ) 0 ); /* sending the message to the queue */
 			}
 			
+			vTaskResourceLock(Led_Resource);
+			GPIO_write(PORT_1, PIN1, current_state); /* the LED follows the button */
+			vTaskResourceUnlock(Led_Resource);
+			
 			previous_state = current_state;
 		}
 		vTaskDelayUntil(&xLastWakeTime,BUTTON1_TASK_PERIOD);
@@ -172,10 +181,9 @@ void Button_1_Monitor(void * pvParameters)
 
 void Button_2_Monitor(void * pvParameters)
 {
-	int xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetTickCount();
 	pinState_t previous_state = PIN_IS_LOW , current_state = PIN_IS_LOW;  /* States for the Button input*/
 	char* button2_message = NULL_PTR; /* pointer to char holds the sent message */
-	vTaskSetApplicationTaskTag(NULL,(void *) 3); /*giving Tag to the task to use Trace Hooks */
 
 	for(;;)
 	{
@@ -206,9 +214,7 @@ void Button_2_Monitor(void * pvParameters)
 void Periodic_Transmitter( void * pvParameters)
 {
 	char* periodic_message = NULL_PTR; /* pointer to char holds the sent message */
-	int xLastWakeTime = xTaskGetTickCount();
-
-	vTaskSetApplicationTaskTag(NULL,(void *) 4); /*giving Tag to the task to use Trace Hooks */
+	TickType_t xLastWakeTime = xTaskGetTickCount();
 
 	for(;;)
 	{
@@ -226,17 +232,14 @@ void Periodic_Transmitter( void * pvParameters)
 void Uart_Receiver( void * pvParameters)
 {
 	char* Received_message = NULL_PTR;
-	int xLastWakeTime = xTaskGetTickCount();
-
-	vTaskSetApplicationTaskTag(NULL,(void *) 5); /*giving Tag to the task to use Trace Hooks */
 
 	for(;;)
 	{
-		if( xQueueReceive( xMessageBuffer, &( Received_message ), ( TickType_t ) 0 ) == pdPASS )
+		/* no polling, the task blocks until a message arrives and then runs on the deadlines of its server */
+		if( xQueueReceive( xMessageBuffer, &( Received_message ), portMAX_DELAY ) == pdPASS )
 		{ 
 			vSerialPutString(Received_message,20); /* receiving the message to the queue */
 		}
-		vTaskDelayUntil(&xLastWakeTime,UART_TASK_PERIOD);
 	}
 }
 
@@ -249,9 +252,8 @@ void Load_1_Simulation( void * pvParameters )
 {
 	int i;
 
-	int xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetTickCount();
 	
-	vTaskSetApplicationTaskTag(NULL,(void *) 6);
     for( ;; )
     {
         /* Task code goes here. */
@@ -261,6 +263,10 @@ void Load_1_Simulation( void * pvParameters )
 				/* for loop to make the excutions time 5ms*/
 			}
 			
+			vTaskResourceLock(Load_LogResource);
+			Load_Jobs[0]++;
+			vTaskResourceUnlock(Load_LogResource);
+			
 			vTaskDelayUntil(&xLastWakeTime,LOAD1_TASK_PERIOD);
     } 
 
@@ -272,9 +278,8 @@ void Load_2_Simulation( void * pvParameters )
 {
 	int i;
 
-	int xLastWakeTime = xTaskGetTickCount();
+	TickType_t xLastWakeTime = xTaskGetTickCount();
 	
-	vTaskSetApplicationTaskTag(NULL,(void *) 7);
     for( ;; )
     {
         /* Task code goes here. */
@@ -285,8 +290,13 @@ void Load_2_Simulation( void * pvParameters )
 				/* for loop to make the excutions time 12ms*/
 			}
 			
-				
-			
+			/* nested locks: the LED is toggled with the log still held, load 1 must not start meanwhile */
+			vTaskResourceLock(Load_LogResource);
+			Load_Jobs[1]++;
+			vTaskResourceLock(Led_Resource);
+			GPIO_write(PORT_1, PIN1, (Load_Jobs[1] & 1) ? PIN_IS_HIGH : PIN_IS_LOW);
+			vTaskResourceUnlock(Led_Resource);
+			vTaskResourceUnlock(Load_LogResource);
 			
 			vTaskDelayUntil(&xLastWakeTime,LOAD2_TASK_PERIOD);
     } 
@@ -307,7 +317,17 @@ void vApplicationTickHook(void)
 
 void vApplicationIdleHook(void)
 {
-	vTaskSetApplicationTaskTag(NULL,(void *) 8); /*giving Tag to the task to use Trace Hooks */
+}
+
+
+/* Called, possibly from the tick interrupt, once for each job that is late.
+ * PORT_1 PIN2 is latched high on the first miss so it shows on the analyzer,
+ * vTaskGetDeadlineStats() gives the counters of each task. */
+void vApplicationDeadlineMissHook(TaskHandle_t xTask, TickType_t xLateness)
+{
+	( void ) xTask;
+	( void ) xLateness;
+	GPIO_write(PORT_1, PIN2, PIN_IS_HIGH);
 }
 
 
@@ -329,24 +349,30 @@ int main( void )
 
 
 
-	xTaskCreatePeriodic(
+	xTaskCreatePeriodicConstrained(
                     Button_1_Monitor,       /* Function that implements the task. */
                     "Button_1_Monitor",          /* Text name for the task. */
-                    100,      /* Stack size in words, not bytes. */
+                    mainTASK_STACK_SIZE,      /* Stack size in words, not bytes. */
                     ( void * ) 0,    /* Parameter passed into the task. */
                     1 ,/* Priority at which the task is created. */
                     &Button_1_MonitorHandler, /* Used to pass out the created task's handle. */
-										BUTTON1_TASK_PERIOD); /*Used t0 pass the period of the task*/
+										BUTTON1_TASK_PERIOD,  /*Used t0 pass the period of the task*/
+										BUTTON1_TASK_PERIOD,  /*implicit deadline*/
+										0,                     /*no phase*/
+										BUTTON_TASK_WCET);     /*counted by the admission control*/
 
 
-	xTaskCreatePeriodic(
+	xTaskCreatePeriodicConstrained(
                     Button_2_Monitor,       /* Function that implements the task. */
                     "Button_2_Monitor",          /* Text name for the task. */
-                    100,      /* Stack size in words, not bytes. */
+                    mainTASK_STACK_SIZE,      /* Stack size in words, not bytes. */
                     ( void * ) 0,    /* Parameter passed into the task. */
                     1 ,/* Priority at which the task is created. */
                     &Button_2_MonitorHandler, /* Used to pass out the created task's handle. */
-										BUTTON2_TASK_PERIOD); /*Used t0 pass the period of the task*/
+										BUTTON2_TASK_PERIOD,  /*Used t0 pass the period of the task*/
+										BUTTON2_TASK_PERIOD,  /*implicit deadline*/
+										0,                     /*no phase*/
+										BUTTON_TASK_WCET);     /*counted by the admission control*/
 
 
 
@@ -355,49 +381,71 @@ int main( void )
 
 
 
-	xTaskCreatePeriodic(
+	xTaskCreatePeriodicConstrained(
                     Periodic_Transmitter,       /* Function that implements the task. */
                     "Periodic_Transmitter",          /* Text name for the task. */
-                    100,      /* Stack size in words, not bytes. */
+                    mainTASK_STACK_SIZE,      /* Stack size in words, not bytes. */
                     ( void * ) 0,    /* Parameter passed into the task. */
                     1 ,/* Priority at which the task is created. */
                     &Periodic_TransmitterHandler, /* Used to pass out the created task's handle. */
-										PERIODIC_TASK_PERIOD);  /*Used t0 pass the period of the task*/    
+										PERIODIC_TASK_PERIOD,    /*Used t0 pass the period of the task*/
+										PERIODIC_TASK_DEADLINE,  /*the message must be queued within a fifth of the period*/
+										0,                       /*released at once, no phase*/
+										PERIODIC_TASK_WCET);     /*counted by the admission control*/
 										
 										
 										
 	xTaskCreatePeriodic(
                     Uart_Receiver,       /* Function that implements the task. */
                     "Load_1_Simulation",          /* Text name for the task. */
-                    100,      /* Stack size in words, not bytes. */
+                    mainTASK_STACK_SIZE,      /* Stack size in words, not bytes. */
                     ( void * ) 0,    /* Parameter passed into the task. */
                     1 ,/* Priority at which the task is created. */
                     &Uart_ReceiverHandler, /* Used to pass out the created task's handle. */
-										UART_TASK_PERIOD);     
+										UART_SERVER_PERIOD);   /*replaced by the deadlines of the server below*/
+
+	/* the receiver gets at most UART_SERVER_BUDGET ticks every UART_SERVER_PERIOD, whenever messages come */
+	Uart_ServerHandler = xTaskCreateServer(UART_SERVER_BUDGET, UART_SERVER_PERIOD);
+	xTaskAttachToServer(Uart_ReceiverHandler, Uart_ServerHandler);
 	
-	 xTaskCreatePeriodic(
+	 xTaskCreatePeriodicConstrained(
                     Load_1_Simulation,       /* Function that implements the task. */
                     "Load_1_Simulation",          /* Text name for the task. */
-                    100,      /* Stack size in words, not bytes. */
+                    mainTASK_STACK_SIZE,      /* Stack size in words, not bytes. */
                     ( void * ) 0,    /* Parameter passed into the task. */
                     1 ,/* Priority at which the task is created. */
                     &Load1Handler, /* Used to pass out the created task's handle. */
-										LOAD1_TASK_PERIOD);     /*Used t0 pass the period of the task*/
+										LOAD1_TASK_PERIOD,   /*Used t0 pass the period of the task*/
+										LOAD1_TASK_PERIOD,   /*implicit deadline*/
+										0,                   /*no phase*/
+										LOAD1_TASK_WCET);    /*the 5ms busy loop*/
 										
-		xTaskCreatePeriodic(
+		xTaskCreatePeriodicConstrained(
                     Load_2_Simulation,       /* Function that implements the task. */
                     "Load_2_Simulation",          /* Text name for the task. */
-                    100,      /* Stack size in words, not bytes. */
+                    mainTASK_STACK_SIZE,      /* Stack size in words, not bytes. */
                     ( void * ) 0,    /* Parameter passed into the task. */
                     1 ,/* Priority at which the task is created. */
                     &Load2Handler, /* Used to pass out the created task's handle. */
-										LOAD2_TASK_PERIOD); /*Used t0 pass the period of the task*/
+										LOAD2_TASK_PERIOD,   /*Used t0 pass the period of the task*/
+										LOAD2_TASK_PERIOD,   /*implicit deadline*/
+										0,                   /*no phase*/
+										LOAD2_TASK_WCET);    /*12ms busy loop, a longer one is demoted at 13ms*/
+
+	/* resources shared under SRP, every user is declared before the scheduler starts */
+	Load_LogResource = xTaskCreateResource();
+	vTaskDeclareResourceUse(Load_LogResource, Load1Handler);
+	vTaskDeclareResourceUse(Load_LogResource, Load2Handler);
+	
+	Led_Resource = xTaskCreateResource();
+	vTaskDeclareResourceUse(Led_Resource, Button_1_MonitorHandler);
+	vTaskDeclareResourceUse(Led_Resource, Load2Handler);
 																			
 										
 										
 										
 		/*Creating the Queue */						
-		xMessageBuffer = xQueueCreate( 3, sizeof( unsigned char[15] ) );
+		xMessageBuffer = xQueueCreate( 3, sizeof( char * ) ); /* the queue carries pointers to the messages */
 
 	/* Now all the tasks have been started - start the scheduler.
 
@@ -421,10 +469,11 @@ void timer1Reset(void)
 	T1TCR &= ~0x2;
 }
 
-/* Function to initialize and start timer 1 */
+/* Function to initialize and start timer 1, free running at the bus clock
+ * for the time stamps of ullTaskGetHighResTimestamp() */
 static void configTimer1(void)
 {
-	T1PR = 1000;
+	T1PR = 0;
 	T1TCR |= 0x1;
 }
 
@@ -439,7 +488,7 @@ static void prvSetupHardware( void )
 	/* Configure GPIO */
 	GPIO_init();
 	
-	/* Config trace timer 1 and read T1TC to get current tick */
+	/* Config timer 1, the time stamp counter */
 	configTimer1();
 
 	/* Setup the peripheral bus to be the same as the PLL output. */
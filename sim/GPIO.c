@@ -0,0 +1,42 @@
+/*
+ * GPIO driver of sim/GPIO.h.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include "GPIO.h"
+
+#define gpioPORTS    ( ( int ) PORT_1 + 1 )
+#define gpioPINS     ( ( int ) PIN7 + 1 )
+
+static volatile pinState_t xPins[ gpioPORTS ][ gpioPINS ];
+/*-----------------------------------------------------------*/
+
+void GPIO_init( void )
+{
+    int iPort, iPin;
+
+    for( iPort = 0; iPort < gpioPORTS; iPort++ )
+    {
+        for( iPin = 0; iPin < gpioPINS; iPin++ )
+        {
+            xPins[ iPort ][ iPin ] = PIN_IS_LOW;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void GPIO_write( portX_t xPort,
+                 pinX_t xPin,
+                 pinState_t xState )
+{
+    xPins[ xPort ][ xPin ] = xState;
+}
+/*-----------------------------------------------------------*/
+
+pinState_t GPIO_read( portX_t xPort,
+                      pinX_t xPin )
+{
+    return xPins[ xPort ][ xPin ];
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,43 @@
+/*
+ * GPIO driver of the demo for the Linux simulator, built with
+ * EDF_POSIX_SIMULATOR.  The pins are kept in memory: outputs hold the last
+ * value written and the buttons read low, as if never pressed.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef GPIO_H
+#define GPIO_H
+
+typedef enum
+{
+    PIN_IS_LOW,
+    PIN_IS_HIGH
+} pinState_t;
+
+typedef enum
+{
+    PORT_0,
+    PORT_1
+} portX_t;
+
+typedef enum
+{
+    PIN0,
+    PIN1,
+    PIN2,
+    PIN3,
+    PIN4,
+    PIN5,
+    PIN6,
+    PIN7
+} pinX_t;
+
+void GPIO_init( void );
+void GPIO_write( portX_t xPort,
+                 pinX_t xPin,
+                 pinState_t xState );
+pinState_t GPIO_read( portX_t xPort,
+                      pinX_t xPin );
+
+#endif /* GPIO_H */
@@ -0,0 +1,13 @@
+/*
+ * The LPC21xx registers of sim/lpc21xx.h.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include "lpc21xx.h"
+
+volatile unsigned long T1TC;
+volatile unsigned long T1PR;
+volatile unsigned long T1TCR;
+volatile unsigned long VPBDIV;
+/*-----------------------------------------------------------*/
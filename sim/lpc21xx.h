@@ -0,0 +1,17 @@
+/*
+ * The LPC21xx registers used by main.c and FreeRTOSConfig.h, for the Linux
+ * simulator built with EDF_POSIX_SIMULATOR.  They are plain variables with no
+ * effect; the time stamps come from sim/port_timestamp.c instead of T1TC.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef LPC21XX_H
+#define LPC21XX_H
+
+extern volatile unsigned long T1TC;
+extern volatile unsigned long T1PR;
+extern volatile unsigned long T1TCR;
+extern volatile unsigned long VPBDIV;
+
+#endif /* LPC21XX_H */
@@ -0,0 +1,21 @@
+/*
+ * portGET_HIGH_RES_TIMESTAMP() for the Linux simulator, built with
+ * EDF_POSIX_SIMULATOR defined.  The kernel extends it to 64 bits from the tick
+ * like the timer of the target, see ullTaskGetHighResTimestamp().
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+/* Microseconds of CLOCK_MONOTONIC, wrapping every 71 minutes. */
+uint32_t ulSimGetHighResTimestamp( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( uint32_t ) ( ( ( uint64_t ) xNow.tv_sec * 1000000ULL ) + ( ( uint64_t ) xNow.tv_nsec / 1000ULL ) );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,34 @@
+/*
+ * UART driver of sim/serial.h.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <stdio.h>
+
+#include "serial.h"
+
+void xSerialPortInitMinimal( unsigned long ulWantedBaud )
+{
+    ( void ) ulWantedBaud;
+
+    /* The tasks write from several threads, have every string out at once. */
+    setvbuf( stdout, NULL, _IONBF, 0 );
+}
+/*-----------------------------------------------------------*/
+
+signed char vSerialPutString( const char * const pcString,
+                              unsigned short usStringLength )
+{
+    unsigned short usLength = 0U;
+
+    while( ( usLength < usStringLength ) && ( pcString[ usLength ] != '\0' ) )
+    {
+        usLength++;
+    }
+
+    ( void ) fwrite( pcString, 1, usLength, stdout );
+
+    return 1;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,18 @@
+/*
+ * UART driver of the demo for the Linux simulator, built with
+ * EDF_POSIX_SIMULATOR.  The strings go to the standard output.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef SERIAL_H
+#define SERIAL_H
+
+void xSerialPortInitMinimal( unsigned long ulWantedBaud );
+
+/* Write pcString up to its terminating NUL or usStringLength characters,
+ * whichever comes first.  Returns 1. */
+signed char vSerialPutString( const char * const pcString,
+                              unsigned short usStringLength );
+
+#endif /* SERIAL_H */
@@ -0,0 +1,501 @@
+/*
+ * EDF scheduler extensions to the FreeRTOS task API.
+ *
+ * These functions are implemented in Tasks.c and are only available when
+ * configUSE_EDF_SCHEDULER is set to 1 in FreeRTOSConfig.h.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef INC_TASK_EDF_H
+#define INC_TASK_EDF_H
+
+#ifndef INC_TASK_H
+    #error "include task.h must appear in source files before include task_edf.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+/* Returned by xTaskCreatePeriodicConstrained() when the admission control
+ * refuses the task. */
+    #define errEDF_TASK_NOT_ADMITTED    ( -6 )
+
+/* Values for configEDF_TIE_BREAK, the order in which ready jobs with the same
+ * absolute deadline run. */
+    #define taskEDF_TIE_BREAK_FIFO           0 /* In the order they became ready.  The running job keeps the processor. */
+    #define taskEDF_TIE_BREAK_ROUND_ROBIN    1 /* As FIFO, but each tick puts the running job behind the others. */
+    #define taskEDF_TIE_BREAK_TASK_NUMBER    2 /* The task that was created first runs first. */
+
+/* Deadline misses, preemptions and migrations of one task, as returned by vTaskGetDeadlineStats(). */
+    typedef struct xTASK_DEADLINE_STATS
+    {
+        uint32_t ulMissCount;       /* Number of jobs that missed their deadline. */
+        TickType_t xWorstLateness;  /* Largest number of ticks a job was seen past its deadline. */
+        TickType_t xLastMissTick;   /* Tick count when the last miss was detected. */
+        uint32_t ulPreemptionCount; /* Number of times the task was switched out while still ready. */
+        uint64_t ullWorstLateness;  /* xWorstLateness in ullTaskGetHighResTimestamp() counts, 0 without configUSE_EDF_HIGH_RES_TIMESTAMP. */
+        uint32_t ulMigrationCount;  /* Number of times the task resumed on another core, 0 without configUSE_EDF_GLOBAL_SCHEDULING. */
+    } TaskDeadlineStats_t;
+
+/* Run time of one task, as returned by vTaskGetLoadStats(). */
+    typedef struct xTASK_LOAD_STATS
+    {
+        configRUN_TIME_COUNTER_TYPE ulRunTime;       /* Run time counter units the task has run since it was created. */
+        configRUN_TIME_COUNTER_TYPE ulWindowRunTime; /* Run time counter units it ran in the last whole load window. */
+        uint32_t ulWindowLoad;                       /* ulWindowRunTime in thousandths of the length of that window. */
+    } TaskLoadStats_t;
+
+/* Number of buckets of each histogram in TaskHistograms_t.  Bucket 0 counts
+ * jobs at 0 ticks, bucket n > 0 those from 2^(n-1) to 2^n - 1 ticks, and the
+ * last bucket everything above. */
+    #ifndef configEDF_HISTOGRAM_BUCKETS
+        #define configEDF_HISTOGRAM_BUCKETS    10
+    #endif
+
+/* Jobs of one task by response time and lateness, as returned by
+ * vTaskGetHistograms().  Every completed job is counted in ulResponseTime, and
+ * in ulEarly or ulLate depending on whether it met its deadline. */
+    typedef struct xTASK_HISTOGRAMS
+    {
+        uint32_t ulResponseTime[ configEDF_HISTOGRAM_BUCKETS ]; /* By ticks from release to completion. */
+        uint32_t ulEarly[ configEDF_HISTOGRAM_BUCKETS ];        /* By ticks from completion to the deadline. */
+        uint32_t ulLate[ configEDF_HISTOGRAM_BUCKETS ];         /* By ticks from the deadline to completion. */
+    } TaskHistograms_t;
+
+/* What happens to a job that uses up its budget, see vTaskSetBudgetPolicy(). */
+    typedef enum
+    {
+        eTaskBudgetNoAction = 0,        /* The overrun is only traced. */
+        eTaskBudgetDemote,              /* The rest of the job runs with the deadline of the next job. */
+        eTaskBudgetSuspendUntilRelease, /* The task is blocked until its next release. */
+        eTaskBudgetPostponeDeadline     /* The deadline is pushed back one period and the budget refilled. */
+    } eTaskBudgetPolicy;
+
+/* Type by which constant bandwidth servers are referenced, see
+ * xTaskCreateServer(). */
+    struct tskEDF_SERVER;
+    typedef struct tskEDF_SERVER * ServerHandle_t;
+
+/* Type by which SRP resources are referenced, see xTaskCreateResource(). */
+    struct tskEDF_RESOURCE;
+    typedef struct tskEDF_RESOURCE * ResourceHandle_t;
+
+/**
+ * task_edf.h
+ * <pre>
+ * BaseType_t xTaskCreatePeriodic(
+ *                            TaskFunction_t pxTaskCode,
+ *                            const char * const pcName,
+ *                            const configSTACK_DEPTH_TYPE usStackDepth,
+ *                            void * const pvParameters,
+ *                            UBaseType_t uxPriority,
+ *                            TaskHandle_t * const pxCreatedTask,
+ *                            TickType_t period
+ *                          );
+ * </pre>
+ *
+ * Create a periodic task with an implicit deadline, equal to its period, and
+ * its first job released at once.  See xTaskCreatePeriodicConstrained().
+ *
+ * No WCET is declared, so the task is neither counted by the admission control
+ * nor held to a budget.  Tasks that have to be admitted must be created with
+ * xTaskCreatePeriodicConstrained() and a WCET.
+ *
+ * \ingroup Tasks
+ */
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        BaseType_t xTaskCreatePeriodic( TaskFunction_t pxTaskCode,
+                                        const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                        const configSTACK_DEPTH_TYPE usStackDepth,
+                                        void * const pvParameters,
+                                        UBaseType_t uxPriority,
+                                        TaskHandle_t * const pxCreatedTask,
+                                        TickType_t period ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task_edf.h
+ * <pre>
+ * BaseType_t xTaskCreatePeriodicConstrained(
+ *                            TaskFunction_t pxTaskCode,
+ *                            const char * const pcName,
+ *                            const configSTACK_DEPTH_TYPE usStackDepth,
+ *                            void * const pvParameters,
+ *                            UBaseType_t uxPriority,
+ *                            TaskHandle_t * const pxCreatedTask,
+ *                            TickType_t period,
+ *                            TickType_t xRelativeDeadline,
+ *                            TickType_t xPhase,
+ *                            TickType_t xWCET
+ *                          );
+ * </pre>
+ *
+ * Create a periodic task whose jobs have a deadline shorter than the period.
+ * xTaskCreatePeriodic() is the same as calling this function with
+ * xRelativeDeadline equal to period, and xPhase and xWCET of zero.
+ *
+ * @param period The number of ticks between the releases of two consecutive
+ * jobs of the task.  The task should wait for its next release with
+ * xTaskDelayUntil() using the same increment.
+ *
+ * @param xRelativeDeadline The number of ticks after each release by which the
+ * job must complete.  Must be greater than zero and no greater than period.
+ * The EDF ready queue is ordered on the resulting absolute deadlines.
+ *
+ * @param xPhase The number of ticks from the call to the release of the first
+ * job.  With a phase of zero the task is ready at once, otherwise it waits in
+ * the Blocked state until its first release.  The pxPreviousWakeTime passed to
+ * xTaskDelayUntil() should then be initialised from xTaskGetTickCount() once
+ * the task has started running.
+ *
+ * @param xWCET The worst case execution time of one job, in ticks.  With
+ * configUSE_EDF_ADMISSION_CONTROL set to 1 the task is refused if the sum of
+ * xWCET / xRelativeDeadline over all the admitted tasks would exceed 1.  With
+ * configUSE_EDF_BUDGET_ENFORCEMENT set to 1 it is also the budget of each job,
+ * see vTaskSetBudgetPolicy().  A task that passes zero, as xTaskCreatePeriodic()
+ * does, is admitted without being counted and its jobs are never held to a
+ * budget.
+ *
+ * The remaining parameters are as for xTaskCreate().
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, errEDF_TASK_NOT_ADMITTED if the admission control refused it,
+ * otherwise an error code defined in the file projdefs.h
+ *
+ * \ingroup Tasks
+ */
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        BaseType_t xTaskCreatePeriodicConstrained( TaskFunction_t pxTaskCode,
+                                                   const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                                   const configSTACK_DEPTH_TYPE usStackDepth,
+                                                   void * const pvParameters,
+                                                   UBaseType_t uxPriority,
+                                                   TaskHandle_t * const pxCreatedTask,
+                                                   TickType_t period,
+                                                   TickType_t xRelativeDeadline,
+                                                   TickType_t xPhase,
+                                                   TickType_t xWCET ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task_edf.h
+ * <pre>
+ * BaseType_t xTaskCreatePeriodicOnCore(
+ *                            TaskFunction_t pxTaskCode,
+ *                            const char * const pcName,
+ *                            const configSTACK_DEPTH_TYPE usStackDepth,
+ *                            void * const pvParameters,
+ *                            UBaseType_t uxPriority,
+ *                            TaskHandle_t * const pxCreatedTask,
+ *                            TickType_t period,
+ *                            TickType_t xRelativeDeadline,
+ *                            TickType_t xPhase,
+ *                            TickType_t xWCET,
+ *                            BaseType_t xCoreID
+ *                          );
+ * </pre>
+ *
+ * As xTaskCreatePeriodicConstrained(), but the task is pinned to core xCoreID.
+ * With configEDF_NUMBER_OF_CORES above 1 each core runs EDF over its own ready
+ * list and the tasks pinned to it, so the tasks are partitioned as
+ * eEDFAnalysisPartition() assigns them and never migrate.
+ * xTaskCreatePeriodicConstrained() pins the task to core 0.  With
+ * configUSE_EDF_GLOBAL_SCHEDULING set to 1 xCoreID is only checked, as the
+ * tasks share one ready list and run on whichever core is free or running the
+ * latest deadline.
+ *
+ * @param xCoreID The core the task runs on, from 0 to
+ * configEDF_NUMBER_OF_CORES - 1.
+ *
+ * \ingroup Tasks
+ */
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        BaseType_t xTaskCreatePeriodicOnCore( TaskFunction_t pxTaskCode,
+                                              const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                              const configSTACK_DEPTH_TYPE usStackDepth,
+                                              void * const pvParameters,
+                                              UBaseType_t uxPriority,
+                                              TaskHandle_t * const pxCreatedTask,
+                                              TickType_t period,
+                                              TickType_t xRelativeDeadline,
+                                              TickType_t xPhase,
+                                              TickType_t xWCET,
+                                              BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task_edf.h
+ * <pre>
+ * void vTaskGetDeadlineStats( TaskHandle_t xTask, TaskDeadlineStats_t * pxStats );
+ * </pre>
+ *
+ * Get the deadline miss counters of a task.  A miss is detected either when
+ * the job completes, that is when the task calls xTaskDelayUntil() after the
+ * deadline, or from the tick interrupt while the late job is the earliest
+ * deadline ready task.  Each job is counted once.  The number of preemptions
+ * of the task is returned as well, to measure the switching overhead, and with
+ * configUSE_EDF_GLOBAL_SCHEDULING the number of times it moved between cores.
+ *
+ * If configUSE_EDF_DEADLINE_MISS_HOOK is set to 1 the application must provide
+ * void vApplicationDeadlineMissHook( TaskHandle_t xTask, TickType_t xLateness ),
+ * which is called once per late job.  It may be called from the tick interrupt,
+ * so it must not call API functions that could block and must only use the
+ * FromISR API.
+ *
+ * @param xTask Handle of the task.  Passing NULL uses the calling task.
+ *
+ * @param pxStats Written with the counters of the task.
+ *
+ * \ingroup TaskUtils
+ */
+    void vTaskGetDeadlineStats( TaskHandle_t xTask,
+                                TaskDeadlineStats_t * pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_edf.h
+ * <pre>
+ * void vTaskSetBudgetPolicy( TaskHandle_t xTask, eTaskBudgetPolicy ePolicy );
+ * </pre>
+ *
+ * configUSE_EDF_BUDGET_ENFORCEMENT must be set to 1 for this function to be
+ * available.  It also requires configGENERATE_RUN_TIME_STATS.
+ *
+ * The execution time of every job is measured with the run time stats counter
+ * and checked against the budget of its task at each tick.  The budget is the
+ * xWCET passed to xTaskCreatePeriodicConstrained(), multiplied by
+ * configEDF_RUN_TIME_COUNTS_PER_TICK.  Tasks with no WCET are not enforced.
+ * New tasks get configEDF_DEFAULT_BUDGET_POLICY.
+ *
+ * With eTaskBudgetSuspendUntilRelease the task resumes where it stopped, so
+ * the rest of the overrunning job runs after the next release and is charged
+ * to the budget of the next job.  That job then has less than its WCET left
+ * for its own work, and a task that keeps overrunning stays one job behind.
+ *
+ * @param xTask Handle of the task.  Passing NULL uses the calling task.
+ *
+ * @param ePolicy What to do with a job that runs out of budget.
+ *
+ * \ingroup TaskCtrl
+ */
+    #if ( configUSE_EDF_BUDGET_ENFORCEMENT == 1 )
+        void vTaskSetBudgetPolicy( TaskHandle_t xTask,
+                                   eTaskBudgetPolicy ePolicy ) PRIVILEGED_FUNCTION;
+
+/* The run time counter units used so far by the current job of xTask, not
+ * counting the time since the running task was last switched in. */
+        configRUN_TIME_COUNTER_TYPE ulTaskGetJobRunTime( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task_edf.h
+ * <pre>
+ * uint32_t ulTaskGetSystemLoad( void );
+ * void vTaskGetLoadStats( TaskHandle_t xTask, TaskLoadStats_t * pxStats );
+ * </pre>
+ *
+ * configUSE_EDF_LOAD_ACCOUNTING must be set to 1 for these functions to be
+ * available.  It also requires configGENERATE_RUN_TIME_STATS.
+ *
+ * The run time of every task is charged as it is switched out, and the time
+ * is divided into slots of configEDF_LOAD_SLOT_TICKS ticks.  The load window is
+ * the last configEDF_LOAD_WINDOW_SLOTS completed slots.  Only additions are done
+ * in the context switch and the tick, the divisions are done when the figures
+ * are read.
+ *
+ * ulTaskGetSystemLoad() returns the time spent in tasks other than idle over
+ * the window, sliding one slot at a time, in thousandths.
+ *
+ * vTaskGetLoadStats() writes the total run time of xTask, and the run time and
+ * thousandths it took of the last whole window, which changes once every
+ * configEDF_LOAD_WINDOW_SLOTS slots.  Passing NULL uses the calling task.
+ *
+ * \ingroup TaskUtils
+ */
+    #if ( configUSE_EDF_LOAD_ACCOUNTING == 1 )
+        uint32_t ulTaskGetSystemLoad( void ) PRIVILEGED_FUNCTION;
+
+        void vTaskGetLoadStats( TaskHandle_t xTask,
+                                TaskLoadStats_t * pxStats ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task_edf.h
+ * <pre>
+ * uint64_t ullTaskGetHighResTimestamp( void );
+ * </pre>
+ *
+ * configUSE_EDF_HIGH_RES_TIMESTAMP must be set to 1 for this function to be
+ * available.
+ *
+ * @return The 32 bit counter read by portGET_HIGH_RES_TIMESTAMP(), extended to
+ * 64 bits with the number of times it wrapped.  It never waits and can be
+ * called from tasks and interrupts, so it can back the run time stats counter
+ * and the trace time stamps, see the demo FreeRTOSConfig.h.
+ *
+ * \ingroup TaskUtils
+ */
+    #if ( configUSE_EDF_HIGH_RES_TIMESTAMP == 1 )
+        uint64_t ullTaskGetHighResTimestamp( void ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task_edf.h
+ * <pre>
+ * void vTaskGetHistograms( TaskHandle_t xTask, TaskHistograms_t * pxHistograms );
+ * void vTaskListHistograms( char * pcWriteBuffer );
+ * </pre>
+ *
+ * configUSE_EDF_JOB_HISTOGRAMS must be set to 1 for these functions to be
+ * available.
+ *
+ * Each job of a periodic task is counted as it completes, that is when the
+ * task calls xTaskDelayUntil(), in log2 buckets of configEDF_HISTOGRAM_BUCKETS.
+ * Counting takes a bounded number of steps and no memory beyond the TCB.
+ *
+ * vTaskGetHistograms() copies the counts of xTask.  Passing NULL uses the
+ * calling task.
+ *
+ * vTaskListHistograms() writes them for every task as text, in the manner of
+ * vTaskList(), with the same configUSE_TRACE_FACILITY and
+ * configUSE_STATS_FORMATTING_FUNCTIONS requirements.  Each task has three lines,
+ * its name then R, E or L for response time, early or late, then the count of
+ * each bucket.  pcWriteBuffer must hold about
+ * ( configMAX_TASK_NAME_LEN + 3 + 11 * configEDF_HISTOGRAM_BUCKETS ) * 3 bytes per
+ * task.
+ *
+ * \ingroup TaskUtils
+ */
+    #if ( configUSE_EDF_JOB_HISTOGRAMS == 1 )
+        void vTaskGetHistograms( TaskHandle_t xTask,
+                                 TaskHistograms_t * pxHistograms ) PRIVILEGED_FUNCTION;
+
+        void vTaskListHistograms( char * pcWriteBuffer ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task_edf.h
+ * <pre>
+ * ServerHandle_t xTaskCreateServer( TickType_t xBudget, TickType_t xPeriod );
+ * </pre>
+ *
+ * configUSE_EDF_CBS must be set to 1 for this function to be available.
+ *
+ * Create a constant bandwidth server (CBS) for aperiodic or sporadic work.  A
+ * task attached to the server with xTaskAttachToServer() is scheduled on the
+ * deadlines of the server instead of on a period.  It should block on the
+ * events it handles - for example a queue, or a notification given by an
+ * interrupt that defers its work to the task - rather than poll.
+ *
+ * When the task becomes ready the server starts a new period, deadline now plus
+ * xPeriod and a full budget, unless what is left of the current one can still
+ * be used within the server bandwidth.  The time the task runs is measured
+ * with the run time stats counter and taken from the budget, and when none is
+ * left the budget is refilled and the deadline postponed by xPeriod.  This
+ * needs configGENERATE_RUN_TIME_STATS and configEDF_RUN_TIME_COUNTS_PER_TICK.
+ * The task thus has a bounded latency, and never takes more than
+ * xBudget / xPeriod of the processor from the periodic tasks.  With
+ * configUSE_EDF_ADMISSION_CONTROL the server is admitted like a periodic task
+ * with that period and WCET.
+ *
+ * @param xBudget Ticks of execution per server period.  Must be greater than
+ * zero and no greater than xPeriod.
+ *
+ * @param xPeriod The server period in ticks.
+ *
+ * @return The handle of the server, or NULL if configEDF_MAX_CBS_SERVERS have
+ * already been created or the admission control refused it.  Servers cannot be
+ * deleted.
+ *
+ * \ingroup Tasks
+ */
+    #if ( configUSE_EDF_CBS == 1 )
+        ServerHandle_t xTaskCreateServer( TickType_t xBudget,
+                                          TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_edf.h
+ * <pre>
+ * BaseType_t xTaskAttachToServer( TaskHandle_t xTask, ServerHandle_t xServer );
+ * </pre>
+ *
+ * Have xTask scheduled by xServer from now on.  A server serves one task, and
+ * the task is detached when it is deleted.  The task is typically created with
+ * xTaskCreatePeriodic(), which declares no WCET, with the period of the
+ * server, and attached before the scheduler is started.
+ *
+ * @return pdPASS, or pdFAIL if the server or the task is already attached.
+ *
+ * \ingroup Tasks
+ */
+        BaseType_t xTaskAttachToServer( TaskHandle_t xTask,
+                                        ServerHandle_t xServer ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task_edf.h
+ * <pre>
+ * ResourceHandle_t xTaskCreateResource( void );
+ * </pre>
+ *
+ * configUSE_EDF_SRP must be set to 1 for this function and the three that
+ * follow to be available.
+ *
+ * Create a resource shared under Baker's Stack Resource Policy (SRP).  Every
+ * task that uses the resource must be declared with vTaskDeclareResourceUse(),
+ * and must hold it between vTaskResourceLock() and vTaskResourceUnlock().
+ *
+ * The preemption level of a task is its relative deadline, the shorter the
+ * higher, and the ceiling of a resource is the highest level of its users.
+ * While resources are locked, a job that has not yet started only starts if
+ * its level is above the highest ceiling among them.  A job is therefore never
+ * blocked once it runs, is blocked at most once by one critical section of a
+ * job with a later deadline, and no deadlock can occur.  As jobs of the same
+ * level never preempt each other they could share one stack, but the tasks
+ * still each have their own.
+ *
+ * A task must not block, or delay, while it holds a resource.
+ *
+ * @return The handle of the resource, or NULL if configEDF_MAX_SRP_RESOURCES
+ * have already been created.
+ *
+ * \ingroup Tasks
+ */
+    #if ( configUSE_EDF_SRP == 1 )
+        ResourceHandle_t xTaskCreateResource( void ) PRIVILEGED_FUNCTION;
+
+/* Declare that xTask locks xResource, raising the ceiling of xResource to the
+ * preemption level of xTask if needed.  Call it for each user of the resource
+ * before the scheduler is started. */
+        void vTaskDeclareResourceUse( ResourceHandle_t xResource,
+                                      TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/* Lock xResource, raising the system ceiling to the ceiling of xResource if
+ * that is higher.  SRP ensures the resource is free, so this never blocks. */
+        void vTaskResourceLock( ResourceHandle_t xResource ) PRIVILEGED_FUNCTION;
+
+/* Unlock xResource, which must be the one locked last by the calling task,
+ * and let the jobs it held back start. */
+        void vTaskResourceUnlock( ResourceHandle_t xResource ) PRIVILEGED_FUNCTION;
+    #endif
+
+    #if ( configUSE_EDF_DEADLINE_MISS_HOOK == 1 )
+
+/* Provided by the application, see vTaskGetDeadlineStats(). */
+        void vApplicationDeadlineMissHook( TaskHandle_t xTask,
+                                           TickType_t xLateness );
+    #endif
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+#endif /* INC_TASK_EDF_H */
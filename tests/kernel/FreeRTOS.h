@@ -0,0 +1,235 @@
+/*
+ * Stand-in for the FreeRTOS.h of the kernel, for the host tests of Tasks.c.
+ *
+ * Holds what Tasks.c takes from FreeRTOS.h, portable.h and the portmacro.h of
+ * a port, and nothing more: the types, the defaults of the configuration
+ * options this tree does not set, and a port whose yield runs the context
+ * switch at once, see port.c.  The tests thus drive the scheduler one tick and
+ * one API call at a time, with no threads and no real context switch.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FreeRTOSConfig.h"
+
+/*-----------------------------------------------------------
+ * Port types and macros.
+ *----------------------------------------------------------*/
+
+typedef long             BaseType_t;
+typedef unsigned long    UBaseType_t;
+typedef uint32_t         StackType_t;
+
+#if ( configUSE_16_BIT_TICKS == 1 )
+    typedef uint16_t     TickType_t;
+    #define portMAX_DELAY    ( TickType_t ) 0xffff
+#else
+    typedef uint32_t     TickType_t;
+    #define portMAX_DELAY    ( TickType_t ) 0xffffffffUL
+#endif
+
+#define portSTACK_GROWTH           ( -1 )
+#define portBYTE_ALIGNMENT_MASK    ( 0x0007 )
+#define portPOINTER_SIZE_TYPE      uintptr_t
+#define portTICK_PERIOD_MS         ( ( TickType_t ) 1 )
+#define portTICK_TYPE_IS_ATOMIC    1
+
+/* A yield switches context at once, or when the critical section it was
+ * requested from is left. */
+void vPortYield( void );
+void vPortEnterCritical( void );
+void vPortExitCritical( void );
+
+#define portYIELD()                                     vPortYield()
+#define portYIELD_WITHIN_API()                          vPortYield()
+#define portYIELD_FROM_ISR( x )                         do { if( ( x ) != 0 ) { vPortYield(); } } while( 0 )
+#define portENTER_CRITICAL()                            vPortEnterCritical()
+#define portEXIT_CRITICAL()                             vPortExitCritical()
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+#define portSET_INTERRUPT_MASK_FROM_ISR()               0
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )          ( void ) ( x )
+#define portTICK_TYPE_ENTER_CRITICAL()
+#define portTICK_TYPE_EXIT_CRITICAL()
+#define portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR()     0
+#define portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( x )    ( void ) ( x )
+
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )     vPortSuppressTicksAndSleep( xExpectedIdleTime )
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+
+#define portNOP()
+#define portSOFTWARE_BARRIER()
+#define portMEMORY_BARRIER()
+#define portSETUP_TCB( pxTCB )                          ( void ) ( pxTCB )
+#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxYieldPending )
+#define portCLEAN_UP_TCB( pxTCB )                       ( void ) ( pxTCB )
+#define portALLOCATE_SECURE_CONTEXT( ulSecureStackSize )
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
+#define portASSERT_IF_IN_ISR()
+#define portCRITICAL_NESTING_IN_TCB                     0
+#define portHAS_STACK_OVERFLOW_CHECKING                 0
+#define portUSING_MPU_WRAPPERS                          0
+#define portPRIVILEGE_BIT                               ( ( UBaseType_t ) 0x00 )
+
+typedef void ( * TaskFunction_t )( void * );
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters );
+BaseType_t xPortStartScheduler( void );
+void vPortEndScheduler( void );
+void * pvPortMalloc( size_t xSize );
+void vPortFree( void * pv );
+
+/* The tick interrupt, and the counter of portGET_HIGH_RES_TIMESTAMP().  A
+ * test moves the counter on to stop part way through a tick, and the tick sets
+ * it to the start of the next one, configEDF_HIGH_RES_COUNTS_PER_TICK on. */
+void vPortTestTick( void );
+extern volatile uint32_t ulPortTestTimestamp;
+
+/* With several cores the test acts on core xPortTestCoreID, and the cores
+ * take turns in that one thread.  An interrupt portYIELD_CORE() sends another
+ * core is held until vPortTestDeliverYields(), which switches context on each
+ * core it was sent to until none is left, and ulPortTestCoreYields counts
+ * them. */
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+    extern volatile BaseType_t xPortTestCoreID;
+    extern volatile uint32_t ulPortTestCoreYields;
+    void vPortYieldCore( BaseType_t xCoreID );
+    void vPortTestDeliverYields( void );
+
+    #define portGET_CORE_ID()            ( xPortTestCoreID )
+    #define portYIELD_CORE( xCoreID )    vPortYieldCore( xCoreID )
+#endif
+
+#define pvPortMallocStack    pvPortMalloc
+#define vPortFreeStack       vPortFree
+
+/*-----------------------------------------------------------
+ * Definitions and defaults of FreeRTOS.h.
+ *----------------------------------------------------------*/
+
+#define pdFALSE                                  ( ( BaseType_t ) 0 )
+#define pdTRUE                                   ( ( BaseType_t ) 1 )
+#define pdPASS                                   ( pdTRUE )
+#define pdFAIL                                   ( pdFALSE )
+#define errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY    ( -1 )
+#define pdMS_TO_TICKS( xTimeInMs )               ( ( TickType_t ) ( xTimeInMs ) )
+
+#ifdef configASSERT
+    #define configASSERT_DEFINED    1
+#else
+    #define configASSERT( x )
+#endif
+
+#define PRIVILEGED_FUNCTION
+#define PRIVILEGED_DATA
+#define mtCOVERAGE_TEST_MARKER()
+
+#define tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE    0
+#define configSUPPORT_STATIC_ALLOCATION              0
+#define configINITIAL_TICK_COUNT                     0
+#define configCHECK_FOR_STACK_OVERFLOW               0
+#define configUSE_TASK_NOTIFICATIONS                 1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES        1
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS      0
+#define configUSE_NEWLIB_REENTRANT                   0
+#define configUSE_POSIX_ERRNO                        0
+#define configRECORD_STACK_HIGH_ADDRESS              0
+#define configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H    0
+#define configSTACK_DEPTH_TYPE                       uint16_t
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP        2
+#define configMINIMAL_SECURE_STACK_SIZE              0
+#define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
+#define taskCHECK_FOR_STACK_OVERFLOW()
+
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#endif
+
+#ifndef configUSE_TICKLESS_IDLE
+    #define configUSE_TICKLESS_IDLE    0
+#endif
+
+#ifndef configGENERATE_RUN_TIME_STATS
+    #define configGENERATE_RUN_TIME_STATS    0
+#endif
+
+#ifndef configRUN_TIME_COUNTER_TYPE
+    #define configRUN_TIME_COUNTER_TYPE    uint32_t
+#endif
+
+#ifndef configUSE_STATS_FORMATTING_FUNCTIONS
+    #define configUSE_STATS_FORMATTING_FUNCTIONS    0
+#endif
+
+#ifndef configUSE_TIMERS
+    #define configUSE_TIMERS    0
+#endif
+
+#ifndef INCLUDE_xTaskGetCurrentTaskHandle
+    #define INCLUDE_xTaskGetCurrentTaskHandle    1
+#endif
+
+#define INCLUDE_xTaskDelayUntil                  INCLUDE_vTaskDelayUntil
+#define INCLUDE_eTaskGetState                    0
+#define INCLUDE_xTaskAbortDelay                  0
+#define INCLUDE_xTaskGetHandle                   0
+#define INCLUDE_xTaskResumeFromISR               1
+#define INCLUDE_xTaskGetIdleTaskHandle           0
+#define INCLUDE_xTaskGetSchedulerState           0
+#define INCLUDE_uxTaskGetStackHighWaterMark      0
+#define INCLUDE_uxTaskGetStackHighWaterMark2     0
+
+/* The trace macros Tasks.c does not give a default itself. */
+#ifndef traceTASK_SWITCHED_IN
+    #define traceTASK_SWITCHED_IN()
+#endif
+#ifndef traceTASK_SWITCHED_OUT
+    #define traceTASK_SWITCHED_OUT()
+#endif
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )
+#define tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#define traceTASK_CREATE( pxNewTCB )
+#define traceTASK_CREATE_FAILED()
+#define traceTASK_DELETE( pxTaskToDelete )
+#define traceTASK_DELAY_UNTIL( x )
+#define traceTASK_DELAY()
+#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
+#define traceTASK_SUSPEND( pxTaskToSuspend )
+#define traceTASK_RESUME( pxTaskToResume )
+#define traceTASK_RESUME_FROM_ISR( pxTaskToResume )
+#define traceTASK_INCREMENT_TICK( xTickCount )
+#define traceINCREASE_TICK_COUNT( x )
+#define traceLOW_POWER_IDLE_BEGIN()
+#define traceLOW_POWER_IDLE_END()
+#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority )
+#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority )
+#define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )
+#define traceTASK_NOTIFY_TAKE( uxIndexToWait )
+#define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )
+#define traceTASK_NOTIFY_WAIT( uxIndexToWait )
+#define traceTASK_NOTIFY( uxIndexToNotify )
+#define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify )
+#define traceRETURN_uxTaskGetSystemState( uxTask )
+
+/* Only the size matters, as static allocation is not used. */
+typedef struct xSTATIC_TCB
+{
+    void * pvDummy;
+} StaticTask_t;
+
+#include "list.h"
+
+#endif /* INC_FREERTOS_H */
@@ -0,0 +1,83 @@
+/*
+ * Configuration of the host tests of Tasks.c: the EDF options of the demo
+ * configuration in ../../FreeRTOSConfig.h, without the LPC21xx hardware and
+ * the trace ring.  Failed kernel assertions abort the test.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+#define configUSE_PREEMPTION            1
+#define configUSE_IDLE_HOOK             0
+#define configUSE_TICK_HOOK             0
+#define configTICK_RATE_HZ              ( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES            ( 4 )
+#define configMINIMAL_STACK_SIZE        ( ( unsigned short ) 90 )
+#define configMAX_TASK_NAME_LEN         ( 8 )
+#define configUSE_TRACE_FACILITY        1
+#define configUSE_16_BIT_TICKS          0
+#define configIDLE_SHOULD_YIELD         1
+#define configUSE_TIME_SLICING          1
+#define configSUPPORT_DYNAMIC_ALLOCATION    1
+#define configUSE_MUTEXES               1
+#define configUSE_APPLICATION_TASK_TAG  1
+
+#define configASSERT( x )               assert( x )
+
+/* EDF scheduler.  test_edf_smp builds it for two cores, with only the
+ * options the kernel supports on more than one, and test_edf_smp_global with
+ * global scheduling on them. */
+#ifndef configEDF_NUMBER_OF_CORES
+    #define configEDF_NUMBER_OF_CORES    1
+#endif
+
+#ifndef configUSE_EDF_GLOBAL_SCHEDULING
+    #define configUSE_EDF_GLOBAL_SCHEDULING    0
+#endif
+
+#define configUSE_EDF_SCHEDULER             1
+#define configEDF_MAX_READY_TASKS           16
+#define configUSE_EDF_DEADLINE_MISS_HOOK    1
+
+/* vPortTestTick() advances the timestamp by a whole tick. */
+#define configUSE_EDF_HIGH_RES_TIMESTAMP      1
+#define portGET_HIGH_RES_TIMESTAMP()          ( ulPortTestTimestamp )
+#define configEDF_HIGH_RES_COUNTS_PER_TICK    1000
+
+#define configGENERATE_RUN_TIME_STATS          1
+#define configRUN_TIME_COUNTER_TYPE            uint64_t
+#define portGET_RUN_TIME_COUNTER_VALUE()       ullTaskGetHighResTimestamp()
+#define configEDF_RUN_TIME_COUNTS_PER_TICK     configEDF_HIGH_RES_COUNTS_PER_TICK
+
+#define configUSE_EDF_DEADLINE_EVENT_LISTS   1
+#define configEDF_TIE_BREAK                  taskEDF_TIE_BREAK_FIFO
+#define configEDF_IDLE_SENTINEL              1
+#define configUSE_EDF_JOB_HISTOGRAMS         1
+
+#if ( configEDF_NUMBER_OF_CORES == 1 )
+    #define configUSE_EDF_HEAP_READY_QUEUE      1
+    #define configUSE_EDF_ADMISSION_CONTROL     1
+    #define configUSE_EDF_BUDGET_ENFORCEMENT    1
+    #define configUSE_EDF_CBS                   1
+    #define configEDF_MAX_CBS_SERVERS           2
+    #define configUSE_EDF_PRIORITY_BANDS        1
+    #define configEDF_BAND_PRIORITY             1
+    #define configUSE_EDF_SRP                   1
+    #define configEDF_MAX_SRP_RESOURCES         2
+    #define configUSE_EDF_LOAD_ACCOUNTING       1
+    #define configEDF_LOAD_SLOT_TICKS           125
+    #define configEDF_LOAD_WINDOW_SLOTS         8
+#endif
+
+#define INCLUDE_vTaskPrioritySet        1
+#define INCLUDE_uxTaskPriorityGet       1
+#define INCLUDE_vTaskDelete             1
+#define INCLUDE_vTaskSuspend            1
+#define INCLUDE_vTaskDelayUntil         1
+#define INCLUDE_vTaskDelay              1
+
+#endif /* FREERTOS_CONFIG_H */
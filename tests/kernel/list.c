@@ -0,0 +1,71 @@
+/*
+ * Stand-in for the list.c of the kernel, for the host tests of Tasks.c.  The
+ * same behaviour as FreeRTOS V10.4, without the integrity checks.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "list.h"
+
+void vListInitialise( List_t * const pxList )
+{
+    pxList->pxIndex = ( ListItem_t * ) &( pxList->xListEnd );
+    pxList->xListEnd.xItemValue = portMAX_DELAY;
+    pxList->xListEnd.pxNext = ( ListItem_t * ) &( pxList->xListEnd );
+    pxList->xListEnd.pxPrevious = ( ListItem_t * ) &( pxList->xListEnd );
+    pxList->uxNumberOfItems = ( UBaseType_t ) 0U;
+}
+/*-----------------------------------------------------------*/
+
+void vListInitialiseItem( ListItem_t * const pxItem )
+{
+    pxItem->pxContainer = NULL;
+}
+/*-----------------------------------------------------------*/
+
+void vListInsertEnd( List_t * const pxList,
+                     ListItem_t * const pxNewListItem )
+{
+    listINSERT_END( pxList, pxNewListItem );
+}
+/*-----------------------------------------------------------*/
+
+void vListInsert( List_t * const pxList,
+                  ListItem_t * const pxNewListItem )
+{
+    ListItem_t * pxIterator;
+    const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
+
+    /* Items of equal value go after the ones already in the list. */
+    if( xValueOfInsertion == portMAX_DELAY )
+    {
+        pxIterator = pxList->xListEnd.pxPrevious;
+    }
+    else
+    {
+        for( pxIterator = ( ListItem_t * ) &( pxList->xListEnd ); pxIterator->pxNext->xItemValue <= xValueOfInsertion; pxIterator = pxIterator->pxNext )
+        {
+        }
+    }
+
+    pxNewListItem->pxNext = pxIterator->pxNext;
+    pxNewListItem->pxNext->pxPrevious = pxNewListItem;
+    pxNewListItem->pxPrevious = pxIterator;
+    pxIterator->pxNext = pxNewListItem;
+    pxNewListItem->pxContainer = pxList;
+
+    ( pxList->uxNumberOfItems )++;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
+{
+    List_t * const pxList = pxItemToRemove->pxContainer;
+
+    listREMOVE_ITEM( pxItemToRemove );
+
+    return pxList->uxNumberOfItems;
+}
@@ -0,0 +1,98 @@
+/*
+ * Stand-in for the list.h of the kernel, for the host tests of Tasks.c.  The
+ * same structures and macros as FreeRTOS V10.4, without the integrity checks.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef LIST_H
+#define LIST_H
+
+#define configLIST_VOLATILE
+
+struct xLIST;
+
+struct xLIST_ITEM
+{
+    configLIST_VOLATILE TickType_t xItemValue;
+    struct xLIST_ITEM * configLIST_VOLATILE pxNext;
+    struct xLIST_ITEM * configLIST_VOLATILE pxPrevious;
+    void * pvOwner;
+    struct xLIST * configLIST_VOLATILE pxContainer;
+};
+typedef struct xLIST_ITEM ListItem_t;
+
+struct xMINI_LIST_ITEM
+{
+    configLIST_VOLATILE TickType_t xItemValue;
+    struct xLIST_ITEM * configLIST_VOLATILE pxNext;
+    struct xLIST_ITEM * configLIST_VOLATILE pxPrevious;
+};
+typedef struct xMINI_LIST_ITEM MiniListItem_t;
+
+typedef struct xLIST
+{
+    volatile UBaseType_t uxNumberOfItems;
+    ListItem_t * configLIST_VOLATILE pxIndex;
+    MiniListItem_t xListEnd;
+} List_t;
+
+#define listSET_LIST_ITEM_OWNER( pxListItem, pxOwner )    ( ( pxListItem )->pvOwner = ( void * ) ( pxOwner ) )
+#define listGET_LIST_ITEM_OWNER( pxListItem )             ( ( pxListItem )->pvOwner )
+#define listSET_LIST_ITEM_VALUE( pxListItem, xValue )     ( ( pxListItem )->xItemValue = ( xValue ) )
+#define listGET_LIST_ITEM_VALUE( pxListItem )             ( ( pxListItem )->xItemValue )
+#define listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxList )        ( ( ( pxList )->xListEnd ).pxNext->xItemValue )
+#define listGET_HEAD_ENTRY( pxList )                      ( ( ( pxList )->xListEnd ).pxNext )
+#define listGET_NEXT( pxListItem )                        ( ( pxListItem )->pxNext )
+#define listGET_END_MARKER( pxList )                      ( ( ListItem_t const * ) ( &( ( pxList )->xListEnd ) ) )
+#define listLIST_IS_EMPTY( pxList )                       ( ( ( pxList )->uxNumberOfItems == ( UBaseType_t ) 0 ) ? pdTRUE : pdFALSE )
+#define listCURRENT_LIST_LENGTH( pxList )                 ( ( pxList )->uxNumberOfItems )
+#define listGET_OWNER_OF_HEAD_ENTRY( pxList )             ( ( &( ( pxList )->xListEnd ) )->pxNext->pvOwner )
+#define listIS_CONTAINED_WITHIN( pxList, pxListItem )     ( ( ( pxListItem )->pxContainer == ( pxList ) ) ? ( pdTRUE ) : ( pdFALSE ) )
+#define listLIST_ITEM_CONTAINER( pxListItem )             ( ( pxListItem )->pxContainer )
+#define listLIST_IS_INITIALISED( pxList )                 ( ( pxList )->xListEnd.xItemValue == portMAX_DELAY )
+
+#define listGET_OWNER_OF_NEXT_ENTRY( pxTCB, pxList )                                        \
+    {                                                                                       \
+        List_t * const pxConstList = ( pxList );                                            \
+        ( pxConstList )->pxIndex = ( pxConstList )->pxIndex->pxNext;                        \
+        if( ( void * ) ( pxConstList )->pxIndex == ( void * ) &( ( pxConstList )->xListEnd ) ) \
+        {                                                                                   \
+            ( pxConstList )->pxIndex = ( pxConstList )->pxIndex->pxNext;                    \
+        }                                                                                   \
+        ( pxTCB ) = ( pxConstList )->pxIndex->pvOwner;                                      \
+    }
+
+#define listREMOVE_ITEM( pxItemToRemove )                                       \
+    {                                                                           \
+        List_t * const pxList = ( pxItemToRemove )->pxContainer;                \
+        ( pxItemToRemove )->pxNext->pxPrevious = ( pxItemToRemove )->pxPrevious; \
+        ( pxItemToRemove )->pxPrevious->pxNext = ( pxItemToRemove )->pxNext;    \
+        if( pxList->pxIndex == ( pxItemToRemove ) )                             \
+        {                                                                       \
+            pxList->pxIndex = ( pxItemToRemove )->pxPrevious;                   \
+        }                                                                       \
+        ( pxItemToRemove )->pxContainer = NULL;                                 \
+        ( pxList->uxNumberOfItems )--;                                          \
+    }
+
+#define listINSERT_END( pxList, pxNewListItem )                   \
+    {                                                             \
+        ListItem_t * const pxIndex = ( pxList )->pxIndex;         \
+        ( pxNewListItem )->pxNext = pxIndex;                      \
+        ( pxNewListItem )->pxPrevious = pxIndex->pxPrevious;      \
+        pxIndex->pxPrevious->pxNext = ( pxNewListItem );          \
+        pxIndex->pxPrevious = ( pxNewListItem );                  \
+        ( pxNewListItem )->pxContainer = ( pxList );              \
+        ( ( pxList )->uxNumberOfItems )++;                        \
+    }
+
+void vListInitialise( List_t * const pxList );
+void vListInitialiseItem( ListItem_t * const pxItem );
+void vListInsert( List_t * const pxList,
+                  ListItem_t * const pxNewListItem );
+void vListInsertEnd( List_t * const pxList,
+                     ListItem_t * const pxNewListItem );
+UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove );
+
+#endif /* LIST_H */
@@ -0,0 +1,150 @@
+/*
+ * Port for the host tests of Tasks.c.
+ *
+ * There are no interrupts and no task really runs: a test plays the part of
+ * whichever task is pxCurrentTCB, calls the API for it, and calls
+ * vPortTestTick() for the tick interrupt.  A yield switches context at once,
+ * or when the critical section it was requested from is left, as it would with
+ * a software interrupt that critical sections mask.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+static UBaseType_t uxCriticalNesting = ( UBaseType_t ) 0U;
+static BaseType_t xSwitchPending = pdFALSE;
+
+volatile uint32_t ulPortTestTimestamp = 0U;
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    if( uxCriticalNesting == ( UBaseType_t ) 0U )
+    {
+        vTaskSwitchContext();
+    }
+    else
+    {
+        xSwitchPending = pdTRUE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    configASSERT( uxCriticalNesting > ( UBaseType_t ) 0U );
+    uxCriticalNesting--;
+
+    if( ( uxCriticalNesting == ( UBaseType_t ) 0U ) && ( xSwitchPending != pdFALSE ) )
+    {
+        xSwitchPending = pdFALSE;
+        vTaskSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortTestTick( void )
+{
+    ulPortTestTimestamp = ( ( ulPortTestTimestamp / ( uint32_t ) configEDF_HIGH_RES_COUNTS_PER_TICK ) + 1U ) * ( uint32_t ) configEDF_HIGH_RES_COUNTS_PER_TICK;
+
+    vPortEnterCritical();
+    {
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            xSwitchPending = pdTRUE;
+        }
+    }
+    vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+
+    volatile BaseType_t xPortTestCoreID = 0;
+    volatile uint32_t ulPortTestCoreYields = 0U;
+    static BaseType_t xCoreYieldPending[ configEDF_NUMBER_OF_CORES ];
+
+    void vPortYieldCore( BaseType_t xCoreID )
+    {
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configEDF_NUMBER_OF_CORES ) && ( xCoreID != xPortTestCoreID ) );
+
+        xCoreYieldPending[ xCoreID ] = pdTRUE;
+        ulPortTestCoreYields++;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortTestDeliverYields( void )
+    {
+        const BaseType_t xCoreID = xPortTestCoreID;
+        BaseType_t x, xDelivered;
+
+        configASSERT( uxCriticalNesting == ( UBaseType_t ) 0U );
+
+        /* A core that switches may interrupt one already served, as a job it
+         * preempted moves on to another core, so start over until none is
+         * pending. */
+        do
+        {
+            xDelivered = pdFALSE;
+
+            for( x = 0; x < configEDF_NUMBER_OF_CORES; x++ )
+            {
+                if( xCoreYieldPending[ x ] != pdFALSE )
+                {
+                    xCoreYieldPending[ x ] = pdFALSE;
+                    xPortTestCoreID = x;
+                    vTaskSwitchContext();
+                    xDelivered = pdTRUE;
+                }
+            }
+        } while( xDelivered != pdFALSE );
+
+        xPortTestCoreID = xCoreID;
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configEDF_NUMBER_OF_CORES */
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    ( void ) pxCode;
+    ( void ) pvParameters;
+
+    return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+    /* The tests go on from vTaskStartScheduler() with the first task current. */
+    return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xSize )
+{
+    return calloc( 1, xSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    free( pv );
+}
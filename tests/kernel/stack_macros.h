@@ -0,0 +1,11 @@
+/*
+ * Stand-in for the stack_macros.h of the kernel, for the host tests of
+ * Tasks.c.  Stack overflow checking is off, see FreeRTOS.h.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef STACK_MACROS_H
+#define STACK_MACROS_H
+
+#endif /* STACK_MACROS_H */
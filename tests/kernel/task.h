@@ -0,0 +1,191 @@
+/*
+ * Stand-in for the task.h of the kernel, for the host tests of Tasks.c.  The
+ * types, macros and prototypes of FreeRTOS V10.4 that Tasks.c and the tests
+ * use; the EDF API itself is in task_edf.h.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "list.h"
+
+#define tskKERNEL_VERSION_NUMBER    "V10.4.6"
+#define tskIDLE_PRIORITY            ( ( UBaseType_t ) 0U )
+
+struct tskTaskControlBlock;
+typedef struct tskTaskControlBlock * TaskHandle_t;
+
+typedef BaseType_t (* TaskHookFunction_t)( void * );
+
+typedef enum
+{
+    eRunning = 0,
+    eReady,
+    eBlocked,
+    eSuspended,
+    eDeleted,
+    eInvalid
+} eTaskState;
+
+typedef enum
+{
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+typedef struct xTIME_OUT
+{
+    BaseType_t xOverflowCount;
+    TickType_t xTimeOnEntering;
+} TimeOut_t;
+
+typedef struct xMEMORY_REGION
+{
+    void * pvBaseAddress;
+    uint32_t ulLengthInBytes;
+    uint32_t ulParameters;
+} MemoryRegion_t;
+
+typedef struct xTASK_STATUS
+{
+    TaskHandle_t xHandle;
+    const char * pcTaskName;
+    UBaseType_t xTaskNumber;
+    eTaskState eCurrentState;
+    UBaseType_t uxCurrentPriority;
+    UBaseType_t uxBasePriority;
+    configRUN_TIME_COUNTER_TYPE ulRunTimeCounter;
+    StackType_t * pxStackBase;
+    configSTACK_DEPTH_TYPE usStackHighWaterMark;
+} TaskStatus_t;
+
+typedef enum
+{
+    eAbortSleep = 0,
+    eStandardSleep,
+    eNoTasksWaitingTimeout
+} eSleepModeStatus;
+
+#define taskSCHEDULER_SUSPENDED      ( ( BaseType_t ) 0 )
+#define taskSCHEDULER_NOT_STARTED    ( ( BaseType_t ) 1 )
+#define taskSCHEDULER_RUNNING        ( ( BaseType_t ) 2 )
+
+#define taskYIELD()                  portYIELD()
+#define taskENTER_CRITICAL()         portENTER_CRITICAL()
+#define taskENTER_CRITICAL_FROM_ISR()    portSET_INTERRUPT_MASK_FROM_ISR()
+#define taskEXIT_CRITICAL()          portEXIT_CRITICAL()
+#define taskEXIT_CRITICAL_FROM_ISR( x )    portCLEAR_INTERRUPT_MASK_FROM_ISR( x )
+#define taskDISABLE_INTERRUPTS()     portDISABLE_INTERRUPTS()
+#define taskENABLE_INTERRUPTS()      portENABLE_INTERRUPTS()
+
+BaseType_t xTaskCreate( TaskFunction_t pxTaskCode,
+                        const char * const pcName,
+                        const configSTACK_DEPTH_TYPE usStackDepth,
+                        void * const pvParameters,
+                        UBaseType_t uxPriority,
+                        TaskHandle_t * const pxCreatedTask );
+void vTaskDelete( TaskHandle_t xTaskToDelete );
+void vTaskDelay( const TickType_t xTicksToDelay );
+BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
+                            const TickType_t xTimeIncrement );
+#define vTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement )    ( void ) xTaskDelayUntil( ( pxPreviousWakeTime ), ( xTimeIncrement ) )
+UBaseType_t uxTaskPriorityGet( const TaskHandle_t xTask );
+eTaskState eTaskGetState( TaskHandle_t xTask );
+void vTaskPrioritySet( TaskHandle_t xTask,
+                       UBaseType_t uxNewPriority );
+void vTaskSuspend( TaskHandle_t xTaskToSuspend );
+void vTaskResume( TaskHandle_t xTaskToResume );
+BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume );
+void vTaskStartScheduler( void );
+void vTaskEndScheduler( void );
+void vTaskSuspendAll( void );
+BaseType_t xTaskResumeAll( void );
+TickType_t xTaskGetTickCount( void );
+TickType_t xTaskGetTickCountFromISR( void );
+UBaseType_t uxTaskGetNumberOfTasks( void );
+char * pcTaskGetName( TaskHandle_t xTaskToQuery );
+void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
+                                 TaskHookFunction_t pxHookFunction );
+TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask );
+TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask );
+BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
+                                         void * pvParameter );
+UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
+                                  const UBaseType_t uxArraySize,
+                                  configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime );
+void vTaskGetInfo( TaskHandle_t xTask,
+                   TaskStatus_t * pxTaskStatus,
+                   BaseType_t xGetFreeStackSpace,
+                   eTaskState eState );
+configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimeCounter( void );
+configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimePercent( void );
+BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify,
+                               UBaseType_t uxIndexToNotify,
+                               uint32_t ulValue,
+                               eNotifyAction eAction,
+                               uint32_t * pulPreviousNotificationValue );
+BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify,
+                                      UBaseType_t uxIndexToNotify,
+                                      uint32_t ulValue,
+                                      eNotifyAction eAction,
+                                      uint32_t * pulPreviousNotificationValue,
+                                      BaseType_t * pxHigherPriorityTaskWoken );
+BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn,
+                                   uint32_t ulBitsToClearOnEntry,
+                                   uint32_t ulBitsToClearOnExit,
+                                   uint32_t * pulNotificationValue,
+                                   TickType_t xTicksToWait );
+void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify,
+                                    UBaseType_t uxIndexToNotify,
+                                    BaseType_t * pxHigherPriorityTaskWoken );
+uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn,
+                                  BaseType_t xClearCountOnExit,
+                                  TickType_t xTicksToWait );
+BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask,
+                                         UBaseType_t uxIndexToClear );
+uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask,
+                                        UBaseType_t uxIndexToClear,
+                                        uint32_t ulBitsToClear );
+#define xTaskNotifyGive( xTaskToNotify )    xTaskGenericNotify( ( xTaskToNotify ), ( 0 ), ( 0 ), eIncrement, NULL )
+#define ulTaskNotifyTake( xClearCountOnExit, xTicksToWait )    ulTaskGenericNotifyTake( ( 0 ), ( xClearCountOnExit ), ( xTicksToWait ) )
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut );
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
+                                 TickType_t * const pxTicksToWait );
+BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp );
+
+/* Functions the kernel itself calls, and the port. */
+BaseType_t xTaskIncrementTick( void );
+void vTaskPlaceOnEventList( List_t * const pxEventList,
+                            const TickType_t xTicksToWait );
+void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
+                                     const TickType_t xItemValue,
+                                     const TickType_t xTicksToWait );
+void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
+                                      TickType_t xTicksToWait,
+                                      const BaseType_t xWaitIndefinitely );
+BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList );
+void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
+                                        const TickType_t xItemValue );
+void vTaskSwitchContext( void );
+TickType_t uxTaskResetEventItemValue( void );
+TaskHandle_t xTaskGetCurrentTaskHandle( void );
+void vTaskMissedYield( void );
+BaseType_t xTaskGetSchedulerState( void );
+BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder );
+BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder );
+void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
+                                          UBaseType_t uxHighestPriorityWaitingTask );
+UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask );
+void vTaskSetTaskNumber( TaskHandle_t xTask,
+                         const UBaseType_t uxHandle );
+void vTaskStepTick( const TickType_t xTicksToJump );
+eSleepModeStatus eTaskConfirmSleepModeStatus( void );
+TaskHandle_t pvTaskIncrementMutexHeldCount( void );
+void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut );
+
+#endif /* INC_TASK_H */
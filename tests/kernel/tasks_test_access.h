@@ -0,0 +1,46 @@
+/*
+ * Access to the file scope state of Tasks.c for the host tests, defined in
+ * tasks_test_access_functions.h.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef TASKS_TEST_ACCESS_H
+#define TASKS_TEST_ACCESS_H
+
+/* The EDF ready heap: its size, the task at uxIndex, and the index the task
+ * itself records, taskEDF_NOT_IN_READY_HEAP ( ~0 ) when it is not in the heap. */
+UBaseType_t uxTaskTestReadyHeapSize( void );
+TaskHandle_t xTaskTestReadyHeapEntry( UBaseType_t uxIndex );
+UBaseType_t uxTaskTestReadyHeapIndex( TaskHandle_t xTask );
+
+/* Number of tasks in xReadyTasksListEDF, the Ready state of the EDF band, or
+ * in the ready list of core 0. */
+UBaseType_t uxTaskTestReadyListLength( void );
+
+/* The deadline the task is scheduled on, and pdTRUE if xTaskA is to run before
+ * xTaskB, ties included. */
+TickType_t xTaskTestGetDeadline( TaskHandle_t xTask );
+BaseType_t xTaskTestRunsBefore( TaskHandle_t xTaskA,
+                                TaskHandle_t xTaskB );
+
+/* Move a task that is in no state list into the EDF Ready state with the given
+ * deadline, and take a Ready task out of it again, as the kernel does. */
+void vTaskTestMakeReady( TaskHandle_t xTask,
+                         TickType_t xDeadline );
+void vTaskTestMakeNotReady( TaskHandle_t xTask );
+
+/* With several cores: the task running on core xCoreID and its idle task, the
+ * core a task is pinned to, and the earliest deadline ready task of the ready
+ * list of core xCoreID, NULL if it is empty. */
+TaskHandle_t xTaskTestGetCurrentOnCore( BaseType_t xCoreID );
+TaskHandle_t xTaskTestGetIdleOnCore( BaseType_t xCoreID );
+BaseType_t xTaskTestGetCore( TaskHandle_t xTask );
+TaskHandle_t xTaskTestGetEarliestReadyOnCore( BaseType_t xCoreID );
+
+/* The task at uxIndex in the ready list of core xCoreID, in deadline order, NULL
+ * past its end.  With global scheduling all the cores share the list. */
+TaskHandle_t xTaskTestGetReadyOnCore( BaseType_t xCoreID,
+                                      UBaseType_t uxIndex );
+
+#endif /* TASKS_TEST_ACCESS_H */
@@ -0,0 +1,124 @@
+/*
+ * Included at the end of Tasks.c when FREERTOS_MODULE_TEST is defined, to give
+ * the host tests access to the state the kernel keeps file scope.  The
+ * prototypes are in tasks_test_access.h.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef TASKS_TEST_ACCESS_FUNCTIONS_H
+#define TASKS_TEST_ACCESS_FUNCTIONS_H
+
+#include "tasks_test_access.h"
+
+#if ( configUSE_EDF_HEAP_READY_QUEUE == 1 )
+
+UBaseType_t uxTaskTestReadyHeapSize( void )
+{
+    return uxEDFReadyHeapSize;
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xTaskTestReadyHeapEntry( UBaseType_t uxIndex )
+{
+    configASSERT( uxIndex < uxEDFReadyHeapSize );
+
+    return pxEDFReadyHeap[ uxIndex ];
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTaskTestReadyHeapIndex( TaskHandle_t xTask )
+{
+    return xTask->uxEDFHeapIndex;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_HEAP_READY_QUEUE */
+
+UBaseType_t uxTaskTestReadyListLength( void )
+{
+    return listCURRENT_LIST_LENGTH( taskEDF_CORE_READY_LIST( 0 ) );
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTaskTestGetDeadline( TaskHandle_t xTask )
+{
+    return taskEDF_GET_DEADLINE( xTask );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskTestRunsBefore( TaskHandle_t xTaskA,
+                                TaskHandle_t xTaskB )
+{
+    return taskEDF_RUNS_BEFORE( xTaskA, xTaskB ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskTestMakeReady( TaskHandle_t xTask,
+                         TickType_t xDeadline )
+{
+    configASSERT( listLIST_ITEM_CONTAINER( &( xTask->xStateListItem ) ) == NULL );
+
+    xTask->xTaskAbsoluteDeadline = xDeadline;
+    prvAddTaskToReadyList( xTask );
+}
+/*-----------------------------------------------------------*/
+
+void vTaskTestMakeNotReady( TaskHandle_t xTask )
+{
+    configASSERT( listIS_CONTAINED_WITHIN( taskEDF_READY_LIST( xTask ), &( xTask->xStateListItem ) ) != pdFALSE );
+
+    ( void ) uxListRemove( &( xTask->xStateListItem ) );
+    prvRemoveTaskFromReadyHeap( xTask );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configEDF_NUMBER_OF_CORES > 1 )
+
+TaskHandle_t xTaskTestGetCurrentOnCore( BaseType_t xCoreID )
+{
+    return pxCurrentTCBs[ xCoreID ];
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xTaskTestGetIdleOnCore( BaseType_t xCoreID )
+{
+    return xIdleTaskHandles[ xCoreID ];
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskTestGetCore( TaskHandle_t xTask )
+{
+    return xTask->xEDFCore;
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xTaskTestGetEarliestReadyOnCore( BaseType_t xCoreID )
+{
+    ( void ) xCoreID;
+
+    return taskEDF_GET_EARLIEST_READY_TASK_ON( xCoreID );
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xTaskTestGetReadyOnCore( BaseType_t xCoreID,
+                                      UBaseType_t uxIndex )
+{
+    List_t * const pxList = taskEDF_CORE_READY_LIST( xCoreID );
+    ListItem_t * pxIterator = listGET_HEAD_ENTRY( pxList );
+
+    ( void ) xCoreID;
+
+    while( ( uxIndex > ( UBaseType_t ) 0U ) && ( pxIterator != listGET_END_MARKER( pxList ) ) )
+    {
+        pxIterator = listGET_NEXT( pxIterator );
+        uxIndex--;
+    }
+
+    return ( pxIterator == listGET_END_MARKER( pxList ) ) ? NULL : listGET_LIST_ITEM_OWNER( pxIterator );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configEDF_NUMBER_OF_CORES */
+
+#endif /* TASKS_TEST_ACCESS_FUNCTIONS_H */
@@ -0,0 +1,13 @@
+/*
+ * Stand-in for the timers.h of the kernel, for the host tests of Tasks.c.  The
+ * tests run without the timer task.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef TIMERS_H
+#define TIMERS_H
+
+BaseType_t xTimerCreateTimerTask( void );
+
+#endif /* TIMERS_H */
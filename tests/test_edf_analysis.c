@@ -0,0 +1,382 @@
+/*
+ * Host regression test of edf_analysis.c.
+ *
+ * QPA is compared with a brute force check of the processor demand at every
+ * integer t up to the hyperperiod plus the longest deadline, over random task
+ * sets small enough for that to be quick, and run on the utilization 1 edge
+ * cases.  The assignments of the partitioner and of the C=D splitter are
+ * checked core by core in the same way.
+ *
+ * Usage: test_edf_analysis [task sets]    (20000 random task sets by default)
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "edf_analysis.h"
+
+#define testMAX_TASKS    6U
+#define testMAX_CORES    3U
+
+#define testCHECK( x )                                                  \
+    do {                                                                \
+        if( !( x ) )                                                    \
+        {                                                               \
+            fprintf( stderr, "%s:%d: failed: %s\n", __FILE__, __LINE__, #x ); \
+            ulFailures++;                                               \
+        }                                                               \
+    } while( 0 )
+
+static unsigned long ulFailures = 0UL;
+static uint32_t ulRandomState = 1U;
+
+/* The LCG of the C standard, so the task sets are the same on every host. */
+static uint32_t prvRandom( uint32_t ulRange )
+{
+    ulRandomState = ( ulRandomState * 1103515245U ) + 12345U;
+
+    return ( ( ulRandomState >> 16 ) & 0x7fffU ) % ulRange;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvGCD( uint64_t ullA,
+                        uint64_t ullB )
+{
+    uint64_t ullRemainder;
+
+    while( ullB != 0U )
+    {
+        ullRemainder = ullA % ullB;
+        ullA = ullB;
+        ullB = ullRemainder;
+    }
+
+    return ullA;
+}
+/*-----------------------------------------------------------*/
+
+/* The exact outcome, from the utilization over the hyperperiod and then the
+ * demand at every t up to the hyperperiod plus the longest deadline. */
+static eEDFAnalysisResult prvBruteForce( const EDFAnalysisTask_t * pxTasks,
+                                         size_t xTaskCount )
+{
+    uint64_t ullHyperperiod = 1U, ullDemand = 0U, t;
+    uint32_t ulLongestDeadline = 0U;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        ullHyperperiod = ( ullHyperperiod / prvGCD( ullHyperperiod, pxTasks[ x ].ulPeriod ) ) * pxTasks[ x ].ulPeriod;
+
+        if( pxTasks[ x ].ulDeadline > ulLongestDeadline )
+        {
+            ulLongestDeadline = pxTasks[ x ].ulDeadline;
+        }
+    }
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        ullDemand += ( uint64_t ) pxTasks[ x ].ulWCET * ( ullHyperperiod / pxTasks[ x ].ulPeriod );
+    }
+
+    if( ullDemand > ullHyperperiod )
+    {
+        return eEDFOverloaded;
+    }
+
+    for( t = 1U; t <= ( ullHyperperiod + ulLongestDeadline ); t++ )
+    {
+        if( ullEDFAnalysisDemand( pxTasks, xTaskCount, ( uint32_t ) t ) > t )
+        {
+            return eEDFDeadlineMiss;
+        }
+    }
+
+    return eEDFSchedulable;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRandomTaskSet( EDFAnalysisTask_t * pxTasks,
+                              size_t xTaskCount,
+                              uint32_t ulLongestPeriod )
+{
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        pxTasks[ x ].ulPeriod = 2U + prvRandom( ulLongestPeriod - 1U );
+
+        /* Mostly constrained deadlines, some arbitrary ones. */
+        pxTasks[ x ].ulDeadline = 1U + prvRandom( pxTasks[ x ].ulPeriod + ( ( prvRandom( 3U ) == 0U ) ? 20U : 0U ) );
+        pxTasks[ x ].ulWCET = prvRandom( ( pxTasks[ x ].ulPeriod / 2U ) + 2U );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestQPARandom( unsigned long ulTaskSets )
+{
+    EDFAnalysisTask_t xTasks[ 4 ];
+    unsigned long ulSet, ulCounts[ eEDFNotProven + 1 ] = { 0UL };
+    uint32_t ulInterval;
+    size_t xTaskCount, x;
+    eEDFAnalysisResult eExpected, eResult;
+
+    for( ulSet = 0UL; ulSet < ulTaskSets; ulSet++ )
+    {
+        xTaskCount = 1U + prvRandom( 4U );
+        prvRandomTaskSet( xTasks, xTaskCount, 31U );
+
+        eExpected = prvBruteForce( xTasks, xTaskCount );
+        eResult = eEDFAnalysisQPA( xTasks, xTaskCount, &ulInterval );
+        ulCounts[ eResult ]++;
+
+        if( eResult != eExpected )
+        {
+            fprintf( stderr, "QPA gave %d, expected %d, for", ( int ) eResult, ( int ) eExpected );
+
+            for( x = 0; x < xTaskCount; x++ )
+            {
+                fprintf( stderr, " {%u,%u,%u}", xTasks[ x ].ulPeriod, xTasks[ x ].ulDeadline, xTasks[ x ].ulWCET );
+            }
+
+            fprintf( stderr, "\n" );
+            ulFailures++;
+        }
+        else if( eResult == eEDFDeadlineMiss )
+        {
+            /* The interval reported is one that really fails. */
+            testCHECK( ullEDFAnalysisDemand( xTasks, xTaskCount, ulInterval ) > ulInterval );
+        }
+        else
+        {
+            testCHECK( ulInterval == 0U );
+        }
+    }
+
+    printf( "QPA: %lu task sets, %lu schedulable, %lu deadline miss, %lu overloaded\n",
+            ulTaskSets, ulCounts[ eEDFSchedulable ], ulCounts[ eEDFDeadlineMiss ], ulCounts[ eEDFOverloaded ] );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestQPAEdgeCases( void )
+{
+    /* Utilization of exactly 1 with implicit deadlines and long periods. */
+    const EDFAnalysisTask_t xFull[] = { { 140006U, 140006U, 70003U }, { 140014U, 140014U, 70007U } };
+
+    /* Utilization of exactly 1 with a constrained deadline, met and missed. */
+    const EDFAnalysisTask_t xFullConstrained[] = { { 10U, 10U, 5U }, { 10U, 5U, 5U } };
+    const EDFAnalysisTask_t xFullMiss[] = { { 10U, 4U, 5U }, { 10U, 5U, 5U } };
+
+    /* Just above and just below 1. */
+    const EDFAnalysisTask_t xOver[] = { { 140006U, 140006U, 70003U }, { 140014U, 140014U, 70008U } };
+    const EDFAnalysisTask_t xUnder[] = { { 140006U, 140006U, 70003U }, { 140014U, 140014U, 70006U }, { 1000U, 900U, 0U } };
+
+    /* A zero period or deadline. */
+    const EDFAnalysisTask_t xInvalid[] = { { 10U, 0U, 1U } };
+    uint32_t ulInterval = 1U;
+
+    testCHECK( eEDFAnalysisQPA( xFull, 2U, &ulInterval ) == eEDFSchedulable );
+    testCHECK( ulInterval == 0U );
+    testCHECK( eEDFAnalysisQPA( xFullConstrained, 2U, NULL ) == eEDFSchedulable );
+    testCHECK( prvBruteForce( xFullConstrained, 2U ) == eEDFSchedulable );
+    testCHECK( eEDFAnalysisQPA( xFullMiss, 2U, &ulInterval ) == eEDFDeadlineMiss );
+    testCHECK( ullEDFAnalysisDemand( xFullMiss, 2U, ulInterval ) > ulInterval );
+    testCHECK( eEDFAnalysisQPA( xOver, 2U, NULL ) == eEDFOverloaded );
+    testCHECK( eEDFAnalysisQPA( xUnder, 3U, NULL ) == eEDFSchedulable );
+    testCHECK( eEDFAnalysisQPA( xInvalid, 1U, NULL ) == eEDFInvalidTaskSet );
+    testCHECK( eEDFAnalysisQPA( xFull, 0U, NULL ) == eEDFSchedulable );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPartition( unsigned long ulTaskSets )
+{
+    EDFAnalysisTask_t xTasks[ testMAX_TASKS ], xWorkspace[ testMAX_TASKS ], xCore[ testMAX_TASKS ];
+    size_t xCoreOfTask[ testMAX_TASKS ], xTaskCount, xCoreCount, xCoreTasks, x, c;
+    unsigned long ulSet, ulPlaced = 0UL;
+    eEDFAnalysisResult eResult;
+
+    /* Six tasks of 0.6 and less on three cores: worst fit spreads the three
+     * largest, one per core, and adds the others to the least loaded. */
+    const EDFAnalysisTask_t xKnown[] = { { 10U, 10U, 6U }, { 10U, 10U, 6U }, { 20U, 20U, 8U }, { 5U, 5U, 1U }, { 40U, 30U, 10U }, { 10U, 10U, 6U } };
+    const size_t xKnownCores[] = { 0U, 1U, 0U, 2U, 1U, 2U };
+
+    testCHECK( eEDFAnalysisPartition( xKnown, 6U, 3U, xWorkspace, xCoreOfTask ) == eEDFSchedulable );
+
+    for( x = 0; x < 6U; x++ )
+    {
+        testCHECK( xCoreOfTask[ x ] == xKnownCores[ x ] );
+    }
+
+    /* A total utilization above 2 cannot go on two cores. */
+    testCHECK( eEDFAnalysisPartition( xKnown, 6U, 2U, xWorkspace, xCoreOfTask ) == eEDFNotPartitioned );
+    testCHECK( eEDFAnalysisPartition( xKnown, 6U, 0U, xWorkspace, xCoreOfTask ) == eEDFInvalidTaskSet );
+
+    for( ulSet = 0UL; ulSet < ulTaskSets; ulSet++ )
+    {
+        xTaskCount = 1U + prvRandom( testMAX_TASKS );
+        xCoreCount = 1U + prvRandom( testMAX_CORES );
+        prvRandomTaskSet( xTasks, xTaskCount, 16U );
+
+        eResult = eEDFAnalysisPartition( xTasks, xTaskCount, xCoreCount, xWorkspace, xCoreOfTask );
+        testCHECK( ( eResult == eEDFSchedulable ) || ( eResult == eEDFNotPartitioned ) );
+
+        for( c = 0; c < xCoreCount; c++ )
+        {
+            xCoreTasks = 0U;
+
+            for( x = 0; x < xTaskCount; x++ )
+            {
+                testCHECK( ( xCoreOfTask[ x ] < xCoreCount ) || ( xCoreOfTask[ x ] == edfANALYSIS_NO_CORE ) );
+
+                if( xCoreOfTask[ x ] == c )
+                {
+                    xCore[ xCoreTasks ] = xTasks[ x ];
+                    xCoreTasks++;
+                }
+            }
+
+            /* Every core is schedulable with what was placed on it. */
+            testCHECK( prvBruteForce( xCore, xCoreTasks ) == eEDFSchedulable );
+        }
+
+        if( eResult == eEDFSchedulable )
+        {
+            ulPlaced++;
+
+            for( x = 0; x < xTaskCount; x++ )
+            {
+                testCHECK( xCoreOfTask[ x ] != edfANALYSIS_NO_CORE );
+            }
+        }
+        else
+        {
+            /* On one core the partitioner is QPA itself. */
+            testCHECK( ( xCoreCount > 1U ) || ( prvBruteForce( xTasks, xTaskCount ) != eEDFSchedulable ) );
+        }
+    }
+
+    printf( "Partition: %lu task sets, %lu placed\n", ulTaskSets, ulPlaced );
+}
+/*-----------------------------------------------------------*/
+
+/* The tasks, and parts of split tasks, that an assignment puts on xCore. */
+static size_t prvSplitCoreTasks( const EDFAnalysisTask_t * pxTasks,
+                                 size_t xTaskCount,
+                                 const EDFAnalysisSplit_t * pxAssignment,
+                                 size_t xCore,
+                                 EDFAnalysisTask_t * pxCoreTasks )
+{
+    size_t x, xCount = 0U;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        if( pxAssignment[ x ].xFirstCore == xCore )
+        {
+            pxCoreTasks[ xCount ].ulPeriod = pxTasks[ x ].ulPeriod;
+            pxCoreTasks[ xCount ].ulWCET = pxAssignment[ x ].ulFirstWCET;
+            pxCoreTasks[ xCount ].ulDeadline = ( pxAssignment[ x ].xSecondCore == edfANALYSIS_NO_CORE ) ? pxTasks[ x ].ulDeadline : pxAssignment[ x ].ulFirstWCET;
+            xCount++;
+        }
+        else if( pxAssignment[ x ].xSecondCore == xCore )
+        {
+            pxCoreTasks[ xCount ].ulPeriod = pxTasks[ x ].ulPeriod;
+            pxCoreTasks[ xCount ].ulWCET = pxTasks[ x ].ulWCET - pxAssignment[ x ].ulFirstWCET;
+            pxCoreTasks[ xCount ].ulDeadline = pxAssignment[ x ].ulSecondDeadline;
+            xCount++;
+        }
+    }
+
+    return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestSplitCD( unsigned long ulTaskSets )
+{
+    EDFAnalysisTask_t xTasks[ testMAX_TASKS ], xWorkspace[ testMAX_TASKS ], xCore[ testMAX_TASKS ];
+    EDFAnalysisSplit_t xAssignment[ testMAX_TASKS ];
+    size_t xCoreOfTask[ testMAX_TASKS ], xTaskCount, xCoreCount, xCoreTasks, x, c;
+    unsigned long ulSet, ulSplit = 0UL, ulBeyondPartition = 0UL;
+    eEDFAnalysisResult eResult;
+
+    /* Three tasks of 0.6 on two cores: no partition, but the third task is
+     * split 4 + 2 over the room left on the two cores. */
+    const EDFAnalysisTask_t xThree[] = { { 10U, 10U, 6U }, { 10U, 10U, 6U }, { 10U, 10U, 6U } };
+
+    /* A task that would need more than its deadline once split. */
+    const EDFAnalysisTask_t xOver[] = { { 100U, 100U, 97U }, { 100U, 100U, 97U }, { 100U, 100U, 7U } };
+
+    testCHECK( eEDFAnalysisPartition( xThree, 3U, 2U, xWorkspace, xCoreOfTask ) == eEDFNotPartitioned );
+    testCHECK( eEDFAnalysisSplitCD( xThree, 3U, 2U, xWorkspace, xAssignment ) == eEDFSchedulable );
+    testCHECK( ( xAssignment[ 0 ].xFirstCore == 0U ) && ( xAssignment[ 0 ].xSecondCore == edfANALYSIS_NO_CORE ) );
+    testCHECK( ( xAssignment[ 1 ].xFirstCore == 1U ) && ( xAssignment[ 1 ].xSecondCore == edfANALYSIS_NO_CORE ) );
+    testCHECK( ( xAssignment[ 2 ].xFirstCore == 0U ) && ( xAssignment[ 2 ].xSecondCore == 1U ) );
+    testCHECK( ( xAssignment[ 2 ].ulFirstWCET == 4U ) && ( xAssignment[ 2 ].ulSecondDeadline == 6U ) );
+    testCHECK( eEDFAnalysisSplitCD( xOver, 3U, 2U, xWorkspace, xAssignment ) == eEDFNotPartitioned );
+    testCHECK( eEDFAnalysisSplitCD( xThree, 3U, 0U, xWorkspace, xAssignment ) == eEDFInvalidTaskSet );
+
+    for( ulSet = 0UL; ulSet < ulTaskSets; ulSet++ )
+    {
+        xTaskCount = 1U + prvRandom( testMAX_TASKS );
+        xCoreCount = 1U + prvRandom( testMAX_CORES );
+        prvRandomTaskSet( xTasks, xTaskCount, 16U );
+
+        eResult = eEDFAnalysisSplitCD( xTasks, xTaskCount, xCoreCount, xWorkspace, xAssignment );
+        testCHECK( ( eResult == eEDFSchedulable ) || ( eResult == eEDFNotPartitioned ) );
+
+        for( x = 0; x < xTaskCount; x++ )
+        {
+            if( xAssignment[ x ].xSecondCore != edfANALYSIS_NO_CORE )
+            {
+                /* Both parts are non-empty, on different cores, and the second
+                 * one fits in what the first leaves of the deadline. */
+                ulSplit++;
+                testCHECK( xAssignment[ x ].xFirstCore != xAssignment[ x ].xSecondCore );
+                testCHECK( ( xAssignment[ x ].ulFirstWCET > 0U ) && ( xAssignment[ x ].ulFirstWCET < xTasks[ x ].ulWCET ) );
+                testCHECK( xAssignment[ x ].ulSecondDeadline == ( xTasks[ x ].ulDeadline - xAssignment[ x ].ulFirstWCET ) );
+                testCHECK( ( xTasks[ x ].ulWCET - xAssignment[ x ].ulFirstWCET ) <= xAssignment[ x ].ulSecondDeadline );
+            }
+        }
+
+        for( c = 0; c < xCoreCount; c++ )
+        {
+            xCoreTasks = prvSplitCoreTasks( xTasks, xTaskCount, xAssignment, c, xCore );
+            testCHECK( prvBruteForce( xCore, xCoreTasks ) == eEDFSchedulable );
+        }
+
+        if( ( eResult == eEDFSchedulable ) &&
+            ( eEDFAnalysisPartition( xTasks, xTaskCount, xCoreCount, xWorkspace, xCoreOfTask ) != eEDFSchedulable ) )
+        {
+            ulBeyondPartition++;
+        }
+    }
+
+    printf( "Split C=D: %lu task sets, %lu tasks split, %lu sets placed that the partitioner could not\n", ulTaskSets, ulSplit, ulBeyondPartition );
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char * argv[] )
+{
+    unsigned long ulTaskSets = 20000UL;
+
+    if( argc > 1 )
+    {
+        ulTaskSets = strtoul( argv[ 1 ], NULL, 0 );
+    }
+
+    prvTestQPAEdgeCases();
+    prvTestQPARandom( ulTaskSets );
+    prvTestPartition( ulTaskSets / 4UL );
+    prvTestSplitCD( ulTaskSets / 4UL );
+
+    if( ulFailures != 0UL )
+    {
+        printf( "%lu checks failed\n", ulFailures );
+        return 1;
+    }
+
+    printf( "all checks passed\n" );
+    return 0;
+}
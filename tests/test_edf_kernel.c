@@ -0,0 +1,688 @@
+/*
+ * Host test of the EDF scheduler of Tasks.c.
+ *
+ * Tasks.c is built with the stand-in kernel headers and port of tests/kernel,
+ * where no task really runs: the test calls the API on behalf of the task
+ * that is current, and vPortTestTick() in place of the tick interrupt.  Each
+ * test leaves the kernel in its own state, so ctest runs one per process.
+ *
+ * Usage: test_edf_kernel <test>    (heap, cbs, cbs-wakeup, srp or inherit)
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_edf.h"
+#include "tasks_test_access.h"
+
+#define testHEAP_TASKS         15U
+#define testHEAP_OPERATIONS    100000UL
+#define testCBS_TICKS          400U
+#define testSRP_TICKS          600U
+
+#define testCHECK( x )                                                  \
+    do {                                                                \
+        if( !( x ) )                                                    \
+        {                                                               \
+            fprintf( stderr, "%s:%d: failed: %s\n", __FILE__, __LINE__, #x ); \
+            ulFailures++;                                               \
+        }                                                               \
+    } while( 0 )
+
+/* A periodic task as the tests run it: each job runs xWCET whole ticks, and
+ * calls xTaskDelayUntil() the next time the task is current.  With a resource
+ * the job holds it from xLockAt ticks into the job to xUnlockAt. */
+typedef struct TEST_PERIODIC_TASK
+{
+    TickType_t xWCET;
+    TickType_t xPeriod;
+    TickType_t xDeadline;
+    TickType_t xPhase;
+    TickType_t xLockAt;
+    TickType_t xUnlockAt;
+    ResourceHandle_t xResource;
+    TaskHandle_t xHandle;
+    TickType_t xWakeTime;
+    TickType_t xLeft;
+    BaseType_t xHolding;
+    unsigned long ulJobs;
+} TestPeriodicTask_t;
+
+#define testPERIODIC_TASK( xWCET, xPeriod, xDeadline, xPhase, xLockAt, xUnlockAt ) \
+    { ( xWCET ), ( xPeriod ), ( xDeadline ), ( xPhase ), ( xLockAt ), ( xUnlockAt ), NULL, NULL, 0U, 0U, pdFALSE, 0UL }
+
+static unsigned long ulFailures = 0UL;
+static unsigned long ulDeadlineMisses = 0UL;
+static uint32_t ulRandomState = 1U;
+
+/* The LCG of the C standard, so the operations are the same on every host. */
+static uint32_t prvRandom( uint32_t ulRange )
+{
+    ulRandomState = ( ulRandomState * 1103515245U ) + 12345U;
+
+    return ( ( ulRandomState >> 16 ) & 0x7fffU ) % ulRange;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationDeadlineMissHook( TaskHandle_t xTask,
+                                   TickType_t xLateness )
+{
+    ( void ) xTask;
+    ( void ) xLateness;
+
+    ulDeadlineMisses++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreatePeriodicTasks( TestPeriodicTask_t * pxTasks,
+                                    size_t xTaskCount )
+{
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        testCHECK( xTaskCreatePeriodicConstrained( prvTask, "periodic", configMINIMAL_STACK_SIZE, NULL, 1U, &( pxTasks[ x ].xHandle ),
+                                                   pxTasks[ x ].xPeriod, pxTasks[ x ].xDeadline, pxTasks[ x ].xPhase, pxTasks[ x ].xWCET ) == pdPASS );
+        pxTasks[ x ].xWakeTime = xTaskGetTickCount() + pxTasks[ x ].xPhase;
+        pxTasks[ x ].xLeft = pxTasks[ x ].xWCET;
+        pxTasks[ x ].ulJobs = 0UL;
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* A mutex as queue.c implements one for the kernel, held by one task while
+ * the others wait in deadline order. */
+static TaskHandle_t xMutexHolder = NULL;
+static List_t xMutexWaiters;
+
+static BaseType_t prvMutexTake( void )
+{
+    BaseType_t xTaken = pdFALSE;
+
+    taskENTER_CRITICAL();
+    {
+        if( xMutexHolder == NULL )
+        {
+            xMutexHolder = pvTaskIncrementMutexHeldCount();
+            xTaken = pdTRUE;
+        }
+        else
+        {
+            ( void ) xTaskPriorityInherit( xMutexHolder );
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if( xTaken == pdFALSE )
+    {
+        vTaskSuspendAll();
+        vTaskPlaceOnEventList( &xMutexWaiters, portMAX_DELAY );
+
+        if( xTaskResumeAll() == pdFALSE )
+        {
+            portYIELD_WITHIN_API();
+        }
+    }
+
+    return xTaken;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMutexGive( void )
+{
+    BaseType_t xYield;
+
+    taskENTER_CRITICAL();
+    {
+        testCHECK( xMutexHolder == xTaskGetCurrentTaskHandle() );
+        xYield = xTaskPriorityDisinherit( xMutexHolder );
+        xMutexHolder = NULL;
+
+        if( ( listLIST_IS_EMPTY( &xMutexWaiters ) == pdFALSE ) && ( xTaskRemoveFromEventList( &xMutexWaiters ) != pdFALSE ) )
+        {
+            xYield = pdTRUE;
+        }
+
+        if( xYield != pdFALSE )
+        {
+            portYIELD_WITHIN_API();
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvEndJob( TestPeriodicTask_t * pxTask )
+{
+    pxTask->ulJobs++;
+    pxTask->xLeft = pxTask->xWCET;
+    ( void ) xTaskDelayUntil( &( pxTask->xWakeTime ), pxTask->xPeriod );
+}
+/*-----------------------------------------------------------*/
+
+/* Play the current task for one tick, and end its job or let go of its
+ * resource when it gets that far.  Returns the task that ran the tick. */
+static TaskHandle_t prvRunTick( TestPeriodicTask_t * pxTasks,
+                                size_t xTaskCount )
+{
+    TestPeriodicTask_t * pxTask = NULL;
+    TaskHandle_t xCurrent;
+    size_t x;
+
+    /* Taking a mutex may block and switch to another task. */
+    for( ; ; )
+    {
+        xCurrent = xTaskGetCurrentTaskHandle();
+
+        for( x = 0; ( x < xTaskCount ) && ( pxTasks[ x ].xHandle != xCurrent ); x++ )
+        {
+        }
+
+        if( x == xTaskCount )
+        {
+            pxTask = NULL;
+            break;
+        }
+
+        pxTask = &( pxTasks[ x ] );
+
+        if( ( pxTask->xWCET > 0U ) && ( pxTask->xLeft == 0U ) )
+        {
+            /* Its unlock at the end of the job was preempted. */
+            prvEndJob( pxTask );
+        }
+        else if( ( pxTask->xUnlockAt == 0U ) || ( pxTask->xHolding != pdFALSE ) || ( ( pxTask->xWCET - pxTask->xLeft ) != pxTask->xLockAt ) )
+        {
+            break;
+        }
+        else if( pxTask->xResource != NULL )
+        {
+            /* SRP only lets a job start when the resources it uses are free,
+             * so the lock never has to wait. */
+            for( x = 0; x < xTaskCount; x++ )
+            {
+                testCHECK( ( pxTasks[ x ].xResource != pxTask->xResource ) || ( pxTasks[ x ].xHolding == pdFALSE ) );
+            }
+
+            vTaskResourceLock( pxTask->xResource );
+            pxTask->xHolding = pdTRUE;
+            break;
+        }
+        else
+        {
+            pxTask->xHolding = prvMutexTake();
+        }
+    }
+
+    /* The work of the tick is done one count before the tick, when the job
+     * may end or unlock its resource. */
+    ulPortTestTimestamp += ( uint32_t ) configEDF_HIGH_RES_COUNTS_PER_TICK - 1U;
+
+    /* A task with no WCET always has work. */
+    if( ( pxTask != NULL ) && ( pxTask->xWCET > 0U ) )
+    {
+        pxTask->xLeft--;
+
+        if( ( pxTask->xHolding != pdFALSE ) && ( ( pxTask->xWCET - pxTask->xLeft ) == pxTask->xUnlockAt ) )
+        {
+            pxTask->xHolding = pdFALSE;
+
+            if( pxTask->xResource != NULL )
+            {
+                vTaskResourceUnlock( pxTask->xResource );
+            }
+            else
+            {
+                prvMutexGive();
+            }
+        }
+
+        /* The job ends just before the tick, if the unlock did not let
+         * another job preempt it. */
+        if( ( pxTask->xLeft == 0U ) && ( xTaskGetCurrentTaskHandle() == xCurrent ) )
+        {
+            prvEndJob( pxTask );
+        }
+    }
+
+    vPortTestTick();
+
+    return xCurrent;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckNoMisses( const TestPeriodicTask_t * pxTasks,
+                              size_t xTaskCount )
+{
+    TaskDeadlineStats_t xStats;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        vTaskGetDeadlineStats( pxTasks[ x ].xHandle, &xStats );
+        testCHECK( xStats.ulMissCount == 0U );
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* The heap order, each task knowing its own index, and the heap holding
+ * exactly the tasks of the EDF Ready list. */
+static void prvCheckHeap( TaskHandle_t * pxTasks,
+                          UBaseType_t uxTaskCount )
+{
+    UBaseType_t uxSize = uxTaskTestReadyHeapSize(), uxIndex, uxInHeap = 0U;
+    TaskHandle_t xTask;
+
+    testCHECK( uxSize == uxTaskTestReadyListLength() );
+
+    for( uxIndex = 0U; uxIndex < uxSize; uxIndex++ )
+    {
+        xTask = xTaskTestReadyHeapEntry( uxIndex );
+        testCHECK( uxTaskTestReadyHeapIndex( xTask ) == uxIndex );
+
+        if( uxIndex > 0U )
+        {
+            testCHECK( xTaskTestRunsBefore( xTask, xTaskTestReadyHeapEntry( ( uxIndex - 1U ) / 2U ) ) == pdFALSE );
+        }
+    }
+
+    for( uxIndex = 0U; uxIndex < uxTaskCount; uxIndex++ )
+    {
+        if( uxTaskTestReadyHeapIndex( pxTasks[ uxIndex ] ) != ~( UBaseType_t ) 0U )
+        {
+            uxInHeap++;
+        }
+    }
+
+    testCHECK( uxInHeap == uxSize );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestHeap( void )
+{
+    TaskHandle_t xTasks[ testHEAP_TASKS ], xHead, xPrevious;
+    unsigned long ulOrder[ testHEAP_TASKS ], ulNextOrder = 0UL, ulOperation;
+    TickType_t xWakeTime[ testHEAP_TASKS ];
+    UBaseType_t x, uxRemaining;
+
+    for( x = 0U; x < testHEAP_TASKS; x++ )
+    {
+        testCHECK( xTaskCreatePeriodic( prvTask, "heap", configMINIMAL_STACK_SIZE, NULL, 1U, &xTasks[ x ], 100U ) == pdPASS );
+        prvCheckHeap( xTasks, x + 1U );
+    }
+
+    for( x = 0U; x < testHEAP_TASKS; x++ )
+    {
+        vTaskTestMakeNotReady( xTasks[ x ] );
+        testCHECK( uxTaskTestReadyHeapIndex( xTasks[ x ] ) == ~( UBaseType_t ) 0U );
+        prvCheckHeap( xTasks, testHEAP_TASKS );
+    }
+
+    testCHECK( uxTaskTestReadyHeapSize() == 0U );
+
+    /* Random insertions and removals anywhere in the heap, with deadlines
+     * across the wrap of the tick count and many equal ones. */
+    for( ulOperation = 0UL; ulOperation < testHEAP_OPERATIONS; ulOperation++ )
+    {
+        x = prvRandom( testHEAP_TASKS );
+
+        if( uxTaskTestReadyHeapIndex( xTasks[ x ] ) == ~( UBaseType_t ) 0U )
+        {
+            vTaskTestMakeReady( xTasks[ x ], ( TickType_t ) 0xffffffe0U + prvRandom( 64U ) );
+        }
+        else
+        {
+            vTaskTestMakeNotReady( xTasks[ x ] );
+        }
+
+        prvCheckHeap( xTasks, testHEAP_TASKS );
+    }
+
+    for( x = 0U; x < testHEAP_TASKS; x++ )
+    {
+        if( uxTaskTestReadyHeapIndex( xTasks[ x ] ) != ~( UBaseType_t ) 0U )
+        {
+            vTaskTestMakeNotReady( xTasks[ x ] );
+        }
+    }
+
+    /* Taking the root out again and again gives the tasks in deadline order,
+     * and equal deadlines in the order the tasks became ready. */
+    for( x = 0U; x < testHEAP_TASKS; x++ )
+    {
+        vTaskTestMakeReady( xTasks[ x ], ( TickType_t ) 0xfffffffcU + prvRandom( 8U ) );
+        ulOrder[ x ] = ulNextOrder++;
+    }
+
+    for( xPrevious = NULL, uxRemaining = testHEAP_TASKS; uxRemaining > 0U; uxRemaining--, xPrevious = xHead )
+    {
+        xHead = xTaskTestReadyHeapEntry( 0U );
+        vTaskTestMakeNotReady( xHead );
+        prvCheckHeap( xTasks, testHEAP_TASKS );
+
+        if( xPrevious != NULL )
+        {
+            testCHECK( xTaskTestRunsBefore( xHead, xPrevious ) == pdFALSE );
+
+            if( xTaskTestGetDeadline( xHead ) == xTaskTestGetDeadline( xPrevious ) )
+            {
+                for( x = 0U; ( xTasks[ x ] != xHead ); x++ )
+                {
+                }
+
+                ulNextOrder = ulOrder[ x ];
+
+                for( x = 0U; ( xTasks[ x ] != xPrevious ); x++ )
+                {
+                }
+
+                testCHECK( ulOrder[ x ] < ulNextOrder );
+            }
+        }
+    }
+
+    /* The scheduler runs the root, and a job that ends leaves the heap for
+     * the next root to run. */
+    for( x = 0U; x < testHEAP_TASKS; x++ )
+    {
+        vTaskTestMakeReady( xTasks[ x ], ( TickType_t ) 10U + prvRandom( 64U ) );
+        xWakeTime[ x ] = 0U;
+    }
+
+    vTaskStartScheduler();
+
+    for( uxRemaining = testHEAP_TASKS; uxRemaining > 0U; uxRemaining-- )
+    {
+        xHead = xTaskGetCurrentTaskHandle();
+        testCHECK( xHead == xTaskTestReadyHeapEntry( 0U ) );
+
+        for( x = 0U; ( x < testHEAP_TASKS ) && ( xTasks[ x ] != xHead ); x++ )
+        {
+        }
+
+        testCHECK( x < testHEAP_TASKS );
+
+        if( x == testHEAP_TASKS )
+        {
+            break;
+        }
+
+        ( void ) xTaskDelayUntil( &xWakeTime[ x ], 100U );
+        testCHECK( uxTaskTestReadyHeapIndex( xHead ) == ~( UBaseType_t ) 0U );
+        testCHECK( xTaskGetCurrentTaskHandle() != xHead );
+        prvCheckHeap( xTasks, testHEAP_TASKS );
+    }
+
+    testCHECK( uxTaskTestReadyHeapSize() == 0U );
+    testCHECK( ulDeadlineMisses == 0UL );
+
+    printf( "Heap: %lu random operations on %u tasks\n", testHEAP_OPERATIONS, ( unsigned ) testHEAP_TASKS );
+}
+/*-----------------------------------------------------------*/
+
+/* A served task that always has work, next to periodic tasks that leave it
+ * 3/10 of the processor.  The server takes no more than its 2/10 from them, but
+ * as its deadline is postponed it also gets the time they leave idle. */
+static void prvTestCBS( void )
+{
+    TestPeriodicTask_t xTasks[] = { testPERIODIC_TASK( 3U, 10U, 10U, 0U, 0U, 0U ), testPERIODIC_TASK( 4U, 10U, 10U, 0U, 0U, 0U ) };
+    const size_t xTaskCount = sizeof( xTasks ) / sizeof( xTasks[ 0 ] );
+    TaskHandle_t xServed, xRan;
+    ServerHandle_t xServer;
+    unsigned long ulServedTicks = 0UL;
+    TickType_t xTick;
+    size_t x;
+
+    prvCreatePeriodicTasks( xTasks, xTaskCount );
+    testCHECK( xTaskCreatePeriodic( prvTask, "served", configMINIMAL_STACK_SIZE, NULL, 1U, &xServed, 10U ) == pdPASS );
+
+    xServer = xTaskCreateServer( 2U, 10U );
+    testCHECK( xServer != NULL );
+    testCHECK( xTaskAttachToServer( xServed, xServer ) == pdPASS );
+    testCHECK( xTaskAttachToServer( xServed, xServer ) == pdFAIL );
+
+    /* 0.3 + 0.4 + 0.2 leaves no room for a server of 2/10. */
+    testCHECK( xTaskCreateServer( 2U, 10U ) == NULL );
+
+    vTaskStartScheduler();
+
+    for( xTick = 0U; xTick < testCBS_TICKS; xTick++ )
+    {
+        xRan = prvRunTick( xTasks, xTaskCount );
+
+        if( xRan == xServed )
+        {
+            ulServedTicks++;
+        }
+
+        /* Each budget of 2 ticks used moves the deadline a period on. */
+        testCHECK( ( ulServedTicks * 10UL ) <= ( ( unsigned long ) xTaskTestGetDeadline( xServed ) * 2UL ) );
+    }
+
+    prvCheckNoMisses( xTasks, xTaskCount );
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        testCHECK( xTasks[ x ].ulJobs >= ( ( testCBS_TICKS / xTasks[ x ].xPeriod ) - 1U ) );
+    }
+
+    testCHECK( ulServedTicks == ( testCBS_TICKS * 3UL ) / 10UL );
+
+    printf( "CBS: served task ran %lu of %u ticks\n", ulServedTicks, ( unsigned ) testCBS_TICKS );
+}
+/*-----------------------------------------------------------*/
+
+/* A served task that wakes every tick and runs 6/10 of it, next to a
+ * background task with a far deadline.  The wake up rule must not let the
+ * early wakes use more than the bandwidth of the server. */
+static void prvTestCBSWakeup( void )
+{
+    TestPeriodicTask_t xBackground = testPERIODIC_TASK( 0U, 1000U, 1000U, 0U, 0U, 0U );
+    const uint32_t ulServedCounts = ( configEDF_HIGH_RES_COUNTS_PER_TICK * 6U ) / 10U;
+    TaskHandle_t xServed;
+    ServerHandle_t xServer;
+    unsigned long ulServedTicks = 0UL, ulBackgroundTicks = 0UL;
+    TickType_t xTick;
+
+    prvCreatePeriodicTasks( &xBackground, 1U );
+    testCHECK( xTaskCreatePeriodic( prvTask, "served", configMINIMAL_STACK_SIZE, NULL, 1U, &xServed, 10U ) == pdPASS );
+    xServer = xTaskCreateServer( 2U, 10U );
+    testCHECK( ( xServer != NULL ) && ( xTaskAttachToServer( xServed, xServer ) == pdPASS ) );
+
+    vTaskStartScheduler();
+
+    for( xTick = 0U; xTick < testCBS_TICKS; xTick++ )
+    {
+        if( xTaskGetCurrentTaskHandle() == xServed )
+        {
+            ulPortTestTimestamp += ulServedCounts;
+            ulServedTicks++;
+            vTaskSuspend( NULL );
+        }
+
+        if( xTaskGetCurrentTaskHandle() == xBackground.xHandle )
+        {
+            ulBackgroundTicks++;
+        }
+
+        vPortTestTick();
+        vTaskResume( xServed );
+
+        /* 6/10 of a tick each time it ran, at 2 ticks per period of 10. */
+        testCHECK( ( ulServedTicks * 6UL ) <= ( ( unsigned long ) xTaskTestGetDeadline( xServed ) * 2UL ) );
+    }
+
+    /* The server got its bandwidth, and the background task the rest. */
+    testCHECK( ( ulServedTicks * 6UL ) >= ( ( ( unsigned long ) testCBS_TICKS - 10UL ) * 2UL ) );
+    testCHECK( ulBackgroundTicks >= ( unsigned long ) testCBS_TICKS - ulServedTicks );
+
+    printf( "CBS wake up: served task woke %lu times in %u ticks\n", ulServedTicks, ( unsigned ) testCBS_TICKS );
+}
+/*-----------------------------------------------------------*/
+
+/* A long job holds a resource for 15 ticks.  A job of a shorter deadline that
+ * uses the resource must not start until it is unlocked, while one with a
+ * preemption level above the ceiling preempts the holder at once. */
+static void prvTestSRP( void )
+{
+    TestPeriodicTask_t xTasks[] =
+    {
+        testPERIODIC_TASK( 20U, 100U, 60U, 0U, 0U, 15U ),
+        testPERIODIC_TASK( 3U, 100U, 20U, 7U, 0U, 3U ),
+        testPERIODIC_TASK( 2U, 100U, 10U, 8U, 0U, 0U ),
+        testPERIODIC_TASK( 2U, 25U, 25U, 1U, 0U, 2U ),
+    };
+    const size_t xTaskCount = sizeof( xTasks ) / sizeof( xTasks[ 0 ] );
+    TestPeriodicTask_t * const pxLong = &( xTasks[ 0 ] );
+    TestPeriodicTask_t * const pxBlocked = &( xTasks[ 1 ] );
+    TestPeriodicTask_t * const pxAbove = &( xTasks[ 2 ] );
+    TickType_t xTick, xBlockedStart = 0U, xAboveStart = 0U;
+    ResourceHandle_t xResource;
+    TaskHandle_t xRan;
+
+    prvCreatePeriodicTasks( xTasks, xTaskCount );
+
+    xResource = xTaskCreateResource();
+    testCHECK( xResource != NULL );
+    pxLong->xResource = xResource;
+    pxBlocked->xResource = xResource;
+    xTasks[ 3 ].xResource = xResource;
+    vTaskDeclareResourceUse( xResource, pxLong->xHandle );
+    vTaskDeclareResourceUse( xResource, pxBlocked->xHandle );
+    vTaskDeclareResourceUse( xResource, xTasks[ 3 ].xHandle );
+
+    vTaskStartScheduler();
+
+    for( xTick = 0U; xTick < testSRP_TICKS; xTick++ )
+    {
+        xRan = prvRunTick( xTasks, xTaskCount );
+
+        if( ( xRan == pxBlocked->xHandle ) && ( xBlockedStart == 0U ) )
+        {
+            xBlockedStart = xTick;
+        }
+        else if( ( xRan == pxAbove->xHandle ) && ( xAboveStart == 0U ) )
+        {
+            xAboveStart = xTick;
+        }
+    }
+
+    /* The long job holds the resource to the end of tick 16, as the job above
+     * the ceiling took ticks 8 and 9 from it.  The job released at 1 that uses
+     * the resource, with a deadline of 26, then goes first. */
+    testCHECK( xAboveStart == 8U );
+    testCHECK( xBlockedStart == 19U );
+
+    prvCheckNoMisses( xTasks, xTaskCount );
+    testCHECK( pxLong->ulJobs == ( testSRP_TICKS / pxLong->xPeriod ) );
+
+    printf( "SRP: blocked job started at %lu, job above the ceiling at %lu\n", ( unsigned long ) xBlockedStart, ( unsigned long ) xAboveStart );
+}
+/*-----------------------------------------------------------*/
+
+/* A job with a late deadline holds a mutex wanted by one with an early
+ * deadline.  The holder runs on the deadline of the waiter until it gives the
+ * mutex, so a job with a deadline between the two cannot delay it. */
+static void prvTestInherit( void )
+{
+    TestPeriodicTask_t xTasks[] =
+    {
+        testPERIODIC_TASK( 10U, 100U, 100U, 0U, 0U, 6U ),
+        testPERIODIC_TASK( 5U, 100U, 50U, 4U, 0U, 0U ),
+        testPERIODIC_TASK( 2U, 100U, 20U, 3U, 0U, 1U ),
+    };
+    const size_t xTaskCount = sizeof( xTasks ) / sizeof( xTasks[ 0 ] );
+    TestPeriodicTask_t * const pxHolder = &( xTasks[ 0 ] );
+    TestPeriodicTask_t * const pxMiddle = &( xTasks[ 1 ] );
+    TestPeriodicTask_t * const pxWaiter = &( xTasks[ 2 ] );
+    TickType_t xTick, xWaiterEnd = 0U;
+    unsigned long ulInheritedTicks = 0UL;
+    TaskHandle_t xRan;
+
+    vListInitialise( &xMutexWaiters );
+    prvCreatePeriodicTasks( xTasks, xTaskCount );
+    vTaskStartScheduler();
+
+    /* One period of the three tasks. */
+    for( xTick = 0U; xTick < 100U; xTick++ )
+    {
+        xRan = prvRunTick( xTasks, xTaskCount );
+
+        if( listLIST_IS_EMPTY( &xMutexWaiters ) == pdFALSE )
+        {
+            testCHECK( xMutexHolder == pxHolder->xHandle );
+            testCHECK( xTaskTestGetDeadline( pxHolder->xHandle ) == xTaskTestGetDeadline( pxWaiter->xHandle ) );
+            testCHECK( xRan == pxHolder->xHandle );
+            ulInheritedTicks++;
+        }
+        else if( pxHolder->ulJobs == 0UL )
+        {
+            /* Its first job, released at 0, is on its own deadline otherwise. */
+            testCHECK( xTaskTestGetDeadline( pxHolder->xHandle ) == pxHolder->xDeadline );
+        }
+
+        if( ( pxWaiter->ulJobs == 1UL ) && ( xWaiterEnd == 0U ) )
+        {
+            xWaiterEnd = xTick;
+        }
+    }
+
+    /* The waiter wanted the mutex in tick 3, and got it when the holder gave it
+     * at the end of tick 5, ahead of the job released at 4. */
+    testCHECK( ulInheritedTicks == 2UL );
+    testCHECK( xWaiterEnd == 7U );
+    testCHECK( pxMiddle->ulJobs == 1UL );
+    prvCheckNoMisses( xTasks, xTaskCount );
+
+    printf( "Deadline inheritance: %lu ticks on the inherited deadline, waiter done in tick %lu\n", ulInheritedTicks, ( unsigned long ) xWaiterEnd );
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char * argv[] )
+{
+    if( ( argc > 1 ) && ( strcmp( argv[ 1 ], "heap" ) == 0 ) )
+    {
+        prvTestHeap();
+    }
+    else if( ( argc > 1 ) && ( strcmp( argv[ 1 ], "cbs" ) == 0 ) )
+    {
+        prvTestCBS();
+    }
+    else if( ( argc > 1 ) && ( strcmp( argv[ 1 ], "cbs-wakeup" ) == 0 ) )
+    {
+        prvTestCBSWakeup();
+    }
+    else if( ( argc > 1 ) && ( strcmp( argv[ 1 ], "srp" ) == 0 ) )
+    {
+        prvTestSRP();
+    }
+    else if( ( argc > 1 ) && ( strcmp( argv[ 1 ], "inherit" ) == 0 ) )
+    {
+        prvTestInherit();
+    }
+    else
+    {
+        fprintf( stderr, "usage: %s heap|cbs|cbs-wakeup|srp|inherit\n", argv[ 0 ] );
+        return 2;
+    }
+
+    if( ulFailures != 0UL )
+    {
+        printf( "%lu checks failed\n", ulFailures );
+        return 1;
+    }
+
+    printf( "all checks passed\n" );
+    return 0;
+}
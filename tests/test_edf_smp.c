@@ -0,0 +1,381 @@
+/*
+ * Host test of the EDF scheduler of Tasks.c on several cores.
+ *
+ * Tasks.c is built for configEDF_NUMBER_OF_CORES cores with the stand-in
+ * kernel headers and port of tests/kernel.  The cores take turns in the one
+ * thread of the test: each tick the test plays the task current on every core
+ * in turn, then runs the tick interrupt on core 0 and delivers the interrupts
+ * the kernel sent the other cores, so the same run is seen on every host.
+ * test_edf_smp runs the tasks pinned to the cores, and test_edf_smp_global is
+ * built with configUSE_EDF_GLOBAL_SCHEDULING.
+ *
+ * Usage: test_edf_smp <test>           (partitioned)
+ *        test_edf_smp_global <test>    (global)
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_edf.h"
+#include "tasks_test_access.h"
+#include "edf_analysis.h"
+
+#define testSMP_TICKS    240U
+
+#define testCHECK( x )                                                  \
+    do {                                                                \
+        if( !( x ) )                                                    \
+        {                                                               \
+            fprintf( stderr, "%s:%d: failed: %s\n", __FILE__, __LINE__, #x ); \
+            ulFailures++;                                               \
+        }                                                               \
+    } while( 0 )
+
+/* A periodic task as the test runs it: each job runs xWCET whole ticks on
+ * whichever core it is current on, and calls xTaskDelayUntil() once done. */
+typedef struct TEST_SMP_TASK
+{
+    TickType_t xWCET;
+    TickType_t xPeriod;
+    TaskHandle_t xHandle;
+    TickType_t xWakeTime;
+    TickType_t xLeft;
+    unsigned long ulJobs;
+} TestSMPTask_t;
+
+#define testSMP_TASK( xWCET, xPeriod )    { ( xWCET ), ( xPeriod ), NULL, 0U, 0U, 0UL }
+
+static unsigned long ulFailures = 0UL;
+static unsigned long ulDeadlineMisses = 0UL;
+
+static void prvTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationDeadlineMissHook( TaskHandle_t xTask,
+                                   TickType_t xLateness )
+{
+    ( void ) xTask;
+    ( void ) xLateness;
+
+    ulDeadlineMisses++;
+}
+/*-----------------------------------------------------------*/
+
+static TestSMPTask_t * prvFindTask( TestSMPTask_t * pxTasks,
+                                    size_t xTaskCount,
+                                    TaskHandle_t xHandle )
+{
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        if( pxTasks[ x ].xHandle == xHandle )
+        {
+            return &( pxTasks[ x ] );
+        }
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/* Play the task current on each core for one tick, ending its job when it has
+ * run its WCET, then tick on core 0 and let the other cores switch. */
+static void prvRunTick( TestSMPTask_t * pxTasks,
+                        size_t xTaskCount,
+                        TaskHandle_t * pxRan )
+{
+    TestSMPTask_t * pxTask;
+    BaseType_t xCoreID;
+
+    for( xCoreID = 0; xCoreID < configEDF_NUMBER_OF_CORES; xCoreID++ )
+    {
+        xPortTestCoreID = xCoreID;
+        pxRan[ xCoreID ] = xTaskGetCurrentTaskHandle();
+        pxTask = prvFindTask( pxTasks, xTaskCount, pxRan[ xCoreID ] );
+
+        if( pxTask != NULL )
+        {
+            pxTask->xLeft--;
+
+            if( pxTask->xLeft == 0U )
+            {
+                pxTask->ulJobs++;
+                pxTask->xLeft = pxTask->xWCET;
+                ( void ) xTaskDelayUntil( &( pxTask->xWakeTime ), pxTask->xPeriod );
+            }
+        }
+    }
+
+    xPortTestCoreID = 0;
+    ulPortTestTimestamp += ( uint32_t ) configEDF_HIGH_RES_COUNTS_PER_TICK - 1U;
+    vPortTestTick();
+    vPortTestDeliverYields();
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckNoMisses( const TestSMPTask_t * pxTasks,
+                              size_t xTaskCount )
+{
+    TaskDeadlineStats_t xStats;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        vTaskGetDeadlineStats( pxTasks[ x ].xHandle, &xStats );
+        testCHECK( xStats.ulMissCount == 0U );
+    }
+
+    testCHECK( ulDeadlineMisses == 0UL );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_GLOBAL_SCHEDULING == 0 )
+
+/* A task set of utilization 1.7, split over the cores by the partitioner and
+ * pinned as it assigns them.  Every core must run the earliest deadline task
+ * pinned to it, or its idle task, and meet every deadline; the jobs released
+ * by the tick on core 0 reach the other core by its interrupt. */
+static void prvTestPartitioned( void )
+{
+    TestSMPTask_t xTasks[] = { testSMP_TASK( 6U, 10U ), testSMP_TASK( 6U, 10U ), testSMP_TASK( 2U, 8U ), testSMP_TASK( 3U, 12U ) };
+    const size_t xTaskCount = sizeof( xTasks ) / sizeof( xTasks[ 0 ] );
+    EDFAnalysisTask_t xAnalysis[ 4 ], xWorkspace[ 4 ];
+    size_t xCoreOfTask[ 4 ];
+    TaskHandle_t xRan[ configEDF_NUMBER_OF_CORES ], xExpected, xVictim;
+    unsigned long ulBusyTicks[ configEDF_NUMBER_OF_CORES ] = { 0UL };
+    BaseType_t xCoreID;
+    TickType_t xTick;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        xAnalysis[ x ].ulPeriod = xTasks[ x ].xPeriod;
+        xAnalysis[ x ].ulDeadline = xTasks[ x ].xPeriod;
+        xAnalysis[ x ].ulWCET = xTasks[ x ].xWCET;
+    }
+
+    testCHECK( eEDFAnalysisPartition( xAnalysis, xTaskCount, configEDF_NUMBER_OF_CORES, xWorkspace, xCoreOfTask ) == eEDFSchedulable );
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        testCHECK( xTaskCreatePeriodicOnCore( prvTask, "pinned", configMINIMAL_STACK_SIZE, NULL, 1U, &( xTasks[ x ].xHandle ),
+                                              xTasks[ x ].xPeriod, xTasks[ x ].xPeriod, 0U, xTasks[ x ].xWCET, ( BaseType_t ) xCoreOfTask[ x ] ) == pdPASS );
+        testCHECK( xTaskTestGetCore( xTasks[ x ].xHandle ) == ( BaseType_t ) xCoreOfTask[ x ] );
+        xTasks[ x ].xLeft = xTasks[ x ].xWCET;
+    }
+
+    vTaskStartScheduler();
+
+    for( xTick = 0U; xTick < testSMP_TICKS; xTick++ )
+    {
+        /* Before the cores run the tick, each has switched to its earliest
+         * deadline ready task. */
+        for( xCoreID = 0; xCoreID < configEDF_NUMBER_OF_CORES; xCoreID++ )
+        {
+            xExpected = xTaskTestGetEarliestReadyOnCore( xCoreID );
+
+            if( xExpected == NULL )
+            {
+                xExpected = xTaskTestGetIdleOnCore( xCoreID );
+            }
+
+            testCHECK( xTaskTestGetCurrentOnCore( xCoreID ) == xExpected );
+            testCHECK( xTaskTestGetCore( xExpected ) == xCoreID );
+        }
+
+        prvRunTick( xTasks, xTaskCount, xRan );
+
+        for( xCoreID = 0; xCoreID < configEDF_NUMBER_OF_CORES; xCoreID++ )
+        {
+            if( prvFindTask( xTasks, xTaskCount, xRan[ xCoreID ] ) != NULL )
+            {
+                ulBusyTicks[ xCoreID ]++;
+            }
+        }
+    }
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        testCHECK( xTasks[ x ].ulJobs >= ( unsigned long ) ( testSMP_TICKS / xTasks[ x ].xPeriod ) - 1UL );
+    }
+
+    prvCheckNoMisses( xTasks, xTaskCount );
+    testCHECK( ulPortTestCoreYields > 0U );
+
+    /* The whole set could not run on one core. */
+    testCHECK( ulBusyTicks[ 0 ] + ulBusyTicks[ 1 ] > ( unsigned long ) testSMP_TICKS );
+
+    /* Deleting from core 0 the task running on core 1 switches core 1 away
+     * from it, and leaves it to the idle task to free. */
+    xPortTestCoreID = 0;
+    xVictim = xTaskTestGetCurrentOnCore( 1 );
+    testCHECK( eTaskGetState( xVictim ) == eRunning );
+    vTaskDelete( xVictim );
+    vPortTestDeliverYields();
+    testCHECK( xTaskTestGetCurrentOnCore( 1 ) != xVictim );
+    testCHECK( eTaskGetState( xVictim ) == eDeleted );
+
+    printf( "Partitioned: %lu and %lu busy ticks of %u on the two cores, %lu interrupts between cores\n",
+            ulBusyTicks[ 0 ], ulBusyTicks[ 1 ], testSMP_TICKS, ( unsigned long ) ulPortTestCoreYields );
+}
+/*-----------------------------------------------------------*/
+
+#else /* configUSE_EDF_GLOBAL_SCHEDULING */
+
+/* A task set of utilization 1.54 that passes the global density test, with
+ * the tasks not pinned.  Before every tick the cores must run the two earliest
+ * deadline ready jobs of the shared list, or the idle task when fewer are
+ * ready, and every deadline must be met, the jobs moving between the cores. */
+static void prvTestGlobal( void )
+{
+    TestSMPTask_t xTasks[] = { testSMP_TASK( 2U, 10U ), testSMP_TASK( 3U, 10U ), testSMP_TASK( 4U, 12U ), testSMP_TASK( 3U, 8U ), testSMP_TASK( 2U, 6U ) };
+    const size_t xTaskCount = sizeof( xTasks ) / sizeof( xTasks[ 0 ] );
+    EDFAnalysisTask_t xAnalysis[ 5 ];
+    TaskHandle_t xRan[ configEDF_NUMBER_OF_CORES ], xReady, xRunning;
+    TickType_t xReadyDeadlines[ configEDF_NUMBER_OF_CORES ], xRunningDeadlines[ configEDF_NUMBER_OF_CORES ], xSwap;
+    TaskDeadlineStats_t xStats;
+    unsigned long ulMigrations = 0UL, ulPreemptions = 0UL, ulBusyTicks = 0UL;
+    size_t xReadyCount, xRunningCount;
+    BaseType_t xCoreID;
+    TickType_t xTick;
+    size_t x;
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        xAnalysis[ x ].ulPeriod = xTasks[ x ].xPeriod;
+        xAnalysis[ x ].ulDeadline = xTasks[ x ].xPeriod;
+        xAnalysis[ x ].ulWCET = xTasks[ x ].xWCET;
+    }
+
+    testCHECK( eEDFAnalysisGlobalGFB( xAnalysis, xTaskCount, configEDF_NUMBER_OF_CORES ) == eEDFSchedulable );
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        testCHECK( xTaskCreatePeriodicConstrained( prvTask, "global", configMINIMAL_STACK_SIZE, NULL, 1U, &( xTasks[ x ].xHandle ),
+                                                   xTasks[ x ].xPeriod, xTasks[ x ].xPeriod, 0U, xTasks[ x ].xWCET ) == pdPASS );
+        xTasks[ x ].xLeft = xTasks[ x ].xWCET;
+    }
+
+    vTaskStartScheduler();
+
+    for( xTick = 0U; xTick < testSMP_TICKS; xTick++ )
+    {
+        /* The deadlines run are those of the earliest ready jobs; the jobs
+         * themselves may differ where deadlines are equal. */
+        xReadyCount = 0;
+        xRunningCount = 0;
+
+        for( xCoreID = 0; xCoreID < configEDF_NUMBER_OF_CORES; xCoreID++ )
+        {
+            xReady = xTaskTestGetReadyOnCore( 0, ( UBaseType_t ) xCoreID );
+
+            if( xReady != NULL )
+            {
+                xReadyDeadlines[ xReadyCount++ ] = xTaskTestGetDeadline( xReady );
+            }
+
+            xRunning = xTaskTestGetCurrentOnCore( xCoreID );
+
+            if( xRunning != xTaskTestGetIdleOnCore( xCoreID ) )
+            {
+                testCHECK( prvFindTask( xTasks, xTaskCount, xRunning ) != NULL );
+                xRunningDeadlines[ xRunningCount++ ] = xTaskTestGetDeadline( xRunning );
+            }
+        }
+
+        testCHECK( xRunningCount == xReadyCount );
+
+        if( ( xRunningCount == 2 ) && ( xRunningDeadlines[ 0 ] > xRunningDeadlines[ 1 ] ) )
+        {
+            xSwap = xRunningDeadlines[ 0 ];
+            xRunningDeadlines[ 0 ] = xRunningDeadlines[ 1 ];
+            xRunningDeadlines[ 1 ] = xSwap;
+        }
+
+        for( x = 0; ( x < xRunningCount ) && ( x < xReadyCount ); x++ )
+        {
+            testCHECK( xRunningDeadlines[ x ] == xReadyDeadlines[ x ] );
+        }
+
+        prvRunTick( xTasks, xTaskCount, xRan );
+
+        for( xCoreID = 0; xCoreID < configEDF_NUMBER_OF_CORES; xCoreID++ )
+        {
+            if( prvFindTask( xTasks, xTaskCount, xRan[ xCoreID ] ) != NULL )
+            {
+                ulBusyTicks++;
+            }
+        }
+    }
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        testCHECK( xTasks[ x ].ulJobs >= ( unsigned long ) ( testSMP_TICKS / xTasks[ x ].xPeriod ) - 1UL );
+
+        vTaskGetDeadlineStats( xTasks[ x ].xHandle, &xStats );
+        ulMigrations += xStats.ulMigrationCount;
+        ulPreemptions += xStats.ulPreemptionCount;
+    }
+
+    prvCheckNoMisses( xTasks, xTaskCount );
+
+    /* The jobs preempted on one core go on on the other, which a released job
+     * reaches by its interrupt, and the idle tasks stay on their own core. */
+    testCHECK( ulMigrations > 0UL );
+    testCHECK( ulPreemptions > 0UL );
+    testCHECK( ulPortTestCoreYields > 0U );
+    testCHECK( ulBusyTicks > ( unsigned long ) testSMP_TICKS );
+
+    for( xCoreID = 0; xCoreID < configEDF_NUMBER_OF_CORES; xCoreID++ )
+    {
+        vTaskGetDeadlineStats( xTaskTestGetIdleOnCore( xCoreID ), &xStats );
+        testCHECK( xStats.ulMigrationCount == 0U );
+    }
+
+    printf( "Global: %lu busy ticks of %u on the two cores, %lu migrations, %lu preemptions, %lu interrupts between cores\n",
+            ulBusyTicks, testSMP_TICKS, ulMigrations, ulPreemptions, ( unsigned long ) ulPortTestCoreYields );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_GLOBAL_SCHEDULING */
+
+int main( int argc,
+          char * argv[] )
+{
+    #if ( configUSE_EDF_GLOBAL_SCHEDULING == 0 )
+        const char * const pcTest = "partitioned";
+    #else
+        const char * const pcTest = "global";
+    #endif
+
+    if( ( argc > 1 ) && ( strcmp( argv[ 1 ], pcTest ) == 0 ) )
+    {
+        #if ( configUSE_EDF_GLOBAL_SCHEDULING == 0 )
+            prvTestPartitioned();
+        #else
+            prvTestGlobal();
+        #endif
+    }
+    else
+    {
+        fprintf( stderr, "usage: %s %s\n", argv[ 0 ], pcTest );
+        return 2;
+    }
+
+    if( ulFailures != 0UL )
+    {
+        printf( "%lu checks failed\n", ulFailures );
+        return 1;
+    }
+
+    printf( "all checks passed\n" );
+    return 0;
+}
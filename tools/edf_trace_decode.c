@@ -0,0 +1,210 @@
+/*
+ * Host decoder for the scheduler trace ring of edf_trace.c.
+ *
+ * Reads a binary dump of xEDFTraceRing, for example taken with
+ *     dump binary memory ring.bin &xEDFTraceRing ((char *)&xEDFTraceRing + sizeof(xEDFTraceRing))
+ * while the target is halted, and prints the events from the oldest to the
+ * newest, the run segments of every task and a summary per task.  The dump is
+ * expected in the little endian byte order of the LPC21xx.
+ *
+ * Build: gcc -I.. -o edf_trace_decode edf_trace_decode.c
+ * Usage: edf_trace_decode ring.bin [-q]    (-q leaves out the event list)
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "edf_trace.h"
+
+#define decodeMAX_TASKS         65536UL  /* Every value of usTaskNumber. */
+#define decodeHEADER_BYTES      12UL     /* ulMagic, ulLength, ulHead. */
+#define decodeRECORD_BYTES      12UL
+
+typedef struct xDECODE_TASK
+{
+    int iRunning;                  /* Switched in and not yet switched out. */
+    uint32_t ulSwitchedIn;         /* Timestamp of the last switch in. */
+    uint64_t ullRunTime;           /* Sum of the closed run segments. */
+    uint32_t ulSegments;           /* Number of closed run segments. */
+    uint32_t ulPreemptions;        /* Number of edfTRACE_PREEMPTED records. */
+    uint32_t ulLongestSegment;
+} DecodeTask_t;
+
+static DecodeTask_t xTasks[ decodeMAX_TASKS ];
+
+static uint32_t prvRead32( const unsigned char * pucBytes )
+{
+    return ( uint32_t ) pucBytes[ 0 ] |
+           ( ( uint32_t ) pucBytes[ 1 ] << 8 ) |
+           ( ( uint32_t ) pucBytes[ 2 ] << 16 ) |
+           ( ( uint32_t ) pucBytes[ 3 ] << 24 );
+}
+/*-----------------------------------------------------------*/
+
+static const char * prvEventName( uint8_t ucEvent )
+{
+    switch( ucEvent )
+    {
+        case edfTRACE_SWITCHED_IN:
+            return "in";
+
+        case edfTRACE_SWITCHED_OUT:
+            return "out";
+
+        case edfTRACE_PREEMPTED:
+            return "preempted";
+
+        default:
+            return "?";
+    }
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char * argv[] )
+{
+    FILE * pxFile;
+    unsigned char * pucDump;
+    long lSize;
+    uint32_t ulLength, ulHead, ulCount, ulFirst, ulIndex;
+    int iQuiet = ( ( argc > 2 ) && ( strcmp( argv[ 2 ], "-q" ) == 0 ) );
+    unsigned long ulTask;
+
+    if( argc < 2 )
+    {
+        fprintf( stderr, "usage: %s ring.bin [-q]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    pxFile = fopen( argv[ 1 ], "rb" );
+
+    if( pxFile == NULL )
+    {
+        perror( argv[ 1 ] );
+        return 2;
+    }
+
+    fseek( pxFile, 0L, SEEK_END );
+    lSize = ftell( pxFile );
+    rewind( pxFile );
+
+    if( lSize < ( long ) decodeHEADER_BYTES )
+    {
+        fprintf( stderr, "%s: too short for a trace ring\n", argv[ 1 ] );
+        fclose( pxFile );
+        return 1;
+    }
+
+    pucDump = malloc( ( size_t ) lSize );
+
+    if( ( pucDump == NULL ) || ( fread( pucDump, 1, ( size_t ) lSize, pxFile ) != ( size_t ) lSize ) )
+    {
+        fprintf( stderr, "%s: cannot read\n", argv[ 1 ] );
+        fclose( pxFile );
+        free( pucDump );
+        return 1;
+    }
+
+    fclose( pxFile );
+
+    ulLength = prvRead32( &pucDump[ 4 ] );
+    ulHead = prvRead32( &pucDump[ 8 ] );
+
+    if( prvRead32( &pucDump[ 0 ] ) != edfTRACE_MAGIC )
+    {
+        fprintf( stderr, "%s: no trace ring (bad magic)\n", argv[ 1 ] );
+        free( pucDump );
+        return 1;
+    }
+
+    /* The length comes from the dump, the target may be built with another
+     * edfTRACE_RING_LENGTH than this decoder. */
+    if( ( ulLength == 0U ) || ( ( ulLength & ( ulLength - 1U ) ) != 0U ) ||
+        ( ( unsigned long ) lSize < decodeHEADER_BYTES + ( ( unsigned long ) ulLength * decodeRECORD_BYTES ) ) )
+    {
+        fprintf( stderr, "%s: bad ring length %lu\n", argv[ 1 ], ( unsigned long ) ulLength );
+        free( pucDump );
+        return 1;
+    }
+
+    /* Only the last ulLength records are still in the ring. */
+    ulCount = ( ulHead < ulLength ) ? ulHead : ulLength;
+    ulFirst = ulHead - ulCount;
+
+    printf( "%lu records written, %lu kept\n", ( unsigned long ) ulHead, ( unsigned long ) ulCount );
+
+    if( iQuiet == 0 )
+    {
+        printf( "%10s  %-9s  %5s  %10s\n", "time", "event", "task", "deadline" );
+    }
+
+    for( ulIndex = ulFirst; ulIndex != ulHead; ulIndex++ )
+    {
+        const unsigned char * pucRecord = &pucDump[ decodeHEADER_BYTES + ( ( ulIndex & ( ulLength - 1U ) ) * decodeRECORD_BYTES ) ];
+        uint32_t ulTimestamp = prvRead32( &pucRecord[ 0 ] );
+        uint8_t ucEvent = pucRecord[ 4 ];
+        uint16_t usTask = ( uint16_t ) ( pucRecord[ 6 ] | ( pucRecord[ 7 ] << 8 ) );
+        uint32_t ulDeadline = prvRead32( &pucRecord[ 8 ] );
+        DecodeTask_t * pxTask = &xTasks[ usTask ];
+
+        if( iQuiet == 0 )
+        {
+            printf( "%10lu  %-9s  %5u  %10lu\n", ( unsigned long ) ulTimestamp, prvEventName( ucEvent ),
+                    ( unsigned ) usTask, ( unsigned long ) ulDeadline );
+        }
+
+        if( ucEvent == edfTRACE_SWITCHED_IN )
+        {
+            pxTask->iRunning = 1;
+            pxTask->ulSwitchedIn = ulTimestamp;
+        }
+        else if( ucEvent == edfTRACE_SWITCHED_OUT )
+        {
+            /* A segment that started before the oldest kept record is dropped. */
+            if( pxTask->iRunning != 0 )
+            {
+                /* Unsigned subtraction, the timestamp source may wrap. */
+                uint32_t ulSegment = ulTimestamp - pxTask->ulSwitchedIn;
+
+                printf( "task %5u ran %10lu .. %10lu  (%lu)  deadline %lu\n", ( unsigned ) usTask,
+                        ( unsigned long ) pxTask->ulSwitchedIn, ( unsigned long ) ulTimestamp,
+                        ( unsigned long ) ulSegment, ( unsigned long ) ulDeadline );
+
+                pxTask->iRunning = 0;
+                pxTask->ullRunTime += ulSegment;
+                pxTask->ulSegments++;
+
+                if( ulSegment > pxTask->ulLongestSegment )
+                {
+                    pxTask->ulLongestSegment = ulSegment;
+                }
+            }
+        }
+        else if( ucEvent == edfTRACE_PREEMPTED )
+        {
+            pxTask->ulPreemptions++;
+        }
+    }
+
+    printf( "%5s  %12s  %8s  %8s  %10s\n", "task", "run time", "segments", "preempt", "longest" );
+
+    for( ulTask = 0UL; ulTask < decodeMAX_TASKS; ulTask++ )
+    {
+        const DecodeTask_t * pxTask = &xTasks[ ulTask ];
+
+        if( ( pxTask->ulSegments != 0U ) || ( pxTask->iRunning != 0 ) )
+        {
+            printf( "%5lu  %12llu  %8lu  %8lu  %10lu%s\n", ulTask, ( unsigned long long ) pxTask->ullRunTime,
+                    ( unsigned long ) pxTask->ulSegments, ( unsigned long ) pxTask->ulPreemptions,
+                    ( unsigned long ) pxTask->ulLongestSegment, ( pxTask->iRunning != 0 ) ? "  (running)" : "" );
+        }
+    }
+
+    free( pucDump );
+
+    return 0;
+}
+/*-----------------------------------------------------------*/